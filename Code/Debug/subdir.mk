@@ -6,22 +6,34 @@
 C_SRCS += \
 ../External_Interrupt.c \
 ../app_file.c \
+../button.c \
+../event_queue.c \
+../isr_dispatch.c \
 ../lcd.c \
 ../main.c \
+../soft_timer.c \
 ../timer.c 
 
 OBJS += \
 ./External_Interrupt.o \
 ./app_file.o \
+./button.o \
+./event_queue.o \
+./isr_dispatch.o \
 ./lcd.o \
 ./main.o \
+./soft_timer.o \
 ./timer.o 
 
 C_DEPS += \
 ./External_Interrupt.d \
 ./app_file.d \
+./button.d \
+./event_queue.d \
+./isr_dispatch.d \
 ./lcd.d \
 ./main.d \
+./soft_timer.d \
 ./timer.d 
 
 
@@ -10,11 +10,115 @@
 
 #include"External_Interrupt_interface.h"
 #include"common_macros.h"
+#include"isr_hooks.h"
+
+/* Subscribers of every external interrupt vector, indexed by INT_ID */
+static IsrDispatch_ListType g_INT_subscribers[INT_VECTORS];
+
+/*
+ * Lock out of every external interrupt, indexed by INT_ID: the quiet period from the
+ * configuration, the level of the released button, the ticks left of the current
+ * period (0 --> not locked) and the edge counters
+ */
+static uint8 g_INT_lockoutTicks[INT_VECTORS];
+static bool g_INT_releasedHigh[INT_VECTORS];
+static volatile uint8 g_INT_quietTicksLeft[INT_VECTORS];
+static volatile uint16 g_INT_acceptedEdges[INT_VECTORS];
+static volatile uint16 g_INT_suppressedEdges[INT_VECTORS];
+
+/*
+ * Count an accepted edge and start the lock out of the interrupt if it is configured,
+ * a macro expanded at the start of every ISR with the constant bits of its own vector,
+ * so the ISR calls no function and touches only its own GICR/GIFR bits.
+ * LOCKED is set TRUE when the interrupt is locked out, its flag must then be kept to
+ * count the bounces
+ */
+#define INT_ACCEPT_EDGE(ID, ENABLE_BIT, FLAG_BIT, LOCKED) \
+	do \
+	{ \
+		g_INT_acceptedEdges[ID]++; \
+		(LOCKED) = FALSE; \
+		if(g_INT_lockoutTicks[ID] != INT_LOCKOUT_DISABLED) \
+		{ \
+			/* Mask the interrupt, the flag goes on recording the bounces */ \
+			GENERAL_INTERRUPT_CONTROL_REGISTER = CLEAR_BIT(GENERAL_INTERRUPT_CONTROL_REGISTER, ENABLE_BIT); \
+			GENERAL_INTERRUPT_FLAG_REGISTER = (1<<(FLAG_BIT)); \
+			g_INT_quietTicksLeft[ID] = g_INT_lockoutTicks[ID]; \
+			(LOCKED) = TRUE; \
+		} \
+	}while(0)
+
+/* Enable bit in GICR and flag bit in GIFR of every external interrupt, indexed by INT_ID */
+static const uint8 g_INT_enableBit[INT_VECTORS] =
+{
+	EXTRNAL_INTERRUPT0_ENABL_BIT, EXTRNAL_INTERRUPT1_ENABL_BIT, EXTRNAL_INTERRUPT2_ENABL_BIT
+};
+static const uint8 g_INT_flagBit[INT_VECTORS] =
+{
+	EXTERNAL_INTERRUPT_FLAG_0, EXTERNAL_INTERRUPT_FLAG_1, EXTERNAL_INTERRUPT_FLAG_2
+};
+
+/***************************************************************************************************
+ * [Function Name]: INT_setLockout
+ *
+ * [Description]:  Function to configure the lock out of an interrupt and clear its counters,
+ *                 called from the Init functions
+ *
+ * [Args]:         a_id, a_lockoutTicks, a_releasedHigh
+ *
+ * [In]            a_id:           External interrupt (INT0, INT1, INT2)
+ *                 a_lockoutTicks: Quiet period in INT_lockoutTick calls, 0 disables the lock out
+ *                 a_releasedHigh: TRUE if the pin reads high when the button is released
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static void INT_setLockout(INT_ID a_id, uint8 a_lockoutTicks, bool a_releasedHigh)
+{
+	uint8 sreg = SREG_REG;
+
+	SREG_REG = CLEAR_BIT(SREG_REG, I_BIT);
+	g_INT_lockoutTicks[a_id] = a_lockoutTicks;
+	g_INT_releasedHigh[a_id] = a_releasedHigh;
+	g_INT_quietTicksLeft[a_id] = 0;
+	g_INT_acceptedEdges[a_id] = 0;
+	g_INT_suppressedEdges[a_id] = 0;
+	SREG_REG = sreg;
+}
+
+/***************************************************************************************************
+ * [Function Name]: INT_isReleased
+ *
+ * [Description]:  Function to read if the button of an external interrupt pin is released
+ *
+ * [Args]:         a_id
+ *
+ * [In]            a_id: External interrupt (INT0, INT1, INT2)
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TRUE if the pin is at the level of the released button
+ ***************************************************************************************************/
+static bool INT_isReleased(INT_ID a_id)
+{
+	bool high;
+
+	switch(a_id)
+	{
+	case INT0_ID:
+		high = BIT_IS_SET(INTERRUPT0_INPUT_PORT, INTERRUPT0_PIN) ? TRUE : FALSE;
+		break;
+	case INT1_ID:
+		high = BIT_IS_SET(INTERRUPT1_INPUT_PORT, INTERRUPT1_PIN) ? TRUE : FALSE;
+		break;
+	default:
+		high = BIT_IS_SET(INTERRUPT2_INPUT_PORT, INTERRUPT2_PIN) ? TRUE : FALSE;
+		break;
+	}
 
-/* Global variables to hold the address of the call back function in the application */
-static volatile void (*g_INT0_callBackPtr)(void) = NULL_PTR;
-static volatile void (*g_INT1_callBackPtr)(void) = NULL_PTR;
-static volatile void (*g_INT2_callBackPtr)(void) = NULL_PTR;
+	return (high == g_INT_releasedHigh[a_id]) ? TRUE : FALSE;
+}
 
 /*******************************************************************************
  *                       Interrupt Service Routines                            *
@@ -24,15 +128,24 @@ static volatile void (*g_INT2_callBackPtr)(void) = NULL_PTR;
  * ************************************************************************/
 ISR(INT0_vect)
 {
-	if(g_INT0_callBackPtr != NULL_PTR)
-	{
-		/* Call the Call Back function in the application after the edge is detected */
-		(*g_INT0_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
-	}
+	bool locked;
 
-	/* Clear the flag if interrupt 0 at the end of ISR */
+	INT_ACCEPT_EDGE(INT0_ID, EXTRNAL_INTERRUPT0_ENABL_BIT, EXTERNAL_INTERRUPT_FLAG_0, locked);
 
-	GENERAL_INTERRUPT_FLAG_REGISTER = SET_BIT(GENERAL_INTERRUPT_FLAG_REGISTER, EXTERNAL_INTERRUPT_FLAG_0);
+#ifdef INT0_HOOK
+	/* Handler bound at compile time (isr_hooks.h) */
+	INT0_HOOK();
+#else
+	/* Call the subscribers of the vector */
+	ISR_DISPATCH_RUN(g_INT_subscribers[INT0_ID]);
+#endif
+
+	/* Clear the flag if interrupt 0 at the end of ISR (written alone so the other pending flags are kept),
+	 * in lock out mode the flag is kept to count the bounces */
+	if(locked == FALSE)
+	{
+		GENERAL_INTERRUPT_FLAG_REGISTER = (1<<EXTERNAL_INTERRUPT_FLAG_0);
+	}
 }
 
 
@@ -42,16 +155,25 @@ ISR(INT0_vect)
 
 ISR(INT1_vect)
 {
-	if(g_INT1_callBackPtr != NULL_PTR)
-	{
-		/* Call the Call Back function in the application after the edge is detected */
-		(*g_INT1_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
-	}
+	bool locked;
 
+	INT_ACCEPT_EDGE(INT1_ID, EXTRNAL_INTERRUPT1_ENABL_BIT, EXTERNAL_INTERRUPT_FLAG_1, locked);
+
+#ifdef INT1_HOOK
+	/* Handler bound at compile time (isr_hooks.h) */
+	INT1_HOOK();
+#else
+	/* Call the subscribers of the vector */
+	ISR_DISPATCH_RUN(g_INT_subscribers[INT1_ID]);
+#endif
 
-	/* Clear the flag if interrupt 1 at the end of ISR */
 
-	GENERAL_INTERRUPT_FLAG_REGISTER = SET_BIT(GENERAL_INTERRUPT_FLAG_REGISTER, EXTERNAL_INTERRUPT_FLAG_1);
+	/* Clear the flag if interrupt 1 at the end of ISR (written alone so the other pending flags are kept),
+	 * in lock out mode the flag is kept to count the bounces */
+	if(locked == FALSE)
+	{
+		GENERAL_INTERRUPT_FLAG_REGISTER = (1<<EXTERNAL_INTERRUPT_FLAG_1);
+	}
 }
 
 
@@ -60,16 +182,25 @@ ISR(INT1_vect)
  * ************************************************************************/
 ISR(INT2_vect)
 {
-	if(g_INT2_callBackPtr != NULL_PTR)
-	{
-		/* Call the Call Back function in the application after the edge is detected */
-		(*g_INT2_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
-	}
+	bool locked;
+
+	INT_ACCEPT_EDGE(INT2_ID, EXTRNAL_INTERRUPT2_ENABL_BIT, EXTERNAL_INTERRUPT_FLAG_2, locked);
 
+#ifdef INT2_HOOK
+	/* Handler bound at compile time (isr_hooks.h) */
+	INT2_HOOK();
+#else
+	/* Call the subscribers of the vector */
+	ISR_DISPATCH_RUN(g_INT_subscribers[INT2_ID]);
+#endif
 
-	/* Clear the flag if interrupt 2 at the end of ISR */
 
-	GENERAL_INTERRUPT_FLAG_REGISTER = SET_BIT(GENERAL_INTERRUPT_FLAG_REGISTER, EXTERNAL_INTERRUPT_FLAG_2);
+	/* Clear the flag if interrupt 2 at the end of ISR (written alone so the other pending flags are kept),
+	 * in lock out mode the flag is kept to count the bounces */
+	if(locked == FALSE)
+	{
+		GENERAL_INTERRUPT_FLAG_REGISTER = (1<<EXTERNAL_INTERRUPT_FLAG_2);
+	}
 }
 
 /***************************************************************************************************
@@ -109,6 +240,10 @@ void INT0_Init(const INT0_ConfigType * INT0_config_PTR)
 	/*configure the control edge for interrupt 0*/
 	MCU_CONTROL_REGISTER = (MCU_CONTROL_REGISTER & 0XFC) | (INT0_config_PTR->INT0_senseControl) ;
 
+	/*configure the lock out of interrupt 0 and clear its edge counters*/
+	INT_setLockout(INT0_ID, INT0_config_PTR->INT0_lockoutTicks,
+			(INT0_config_PTR->INT0_senseControl != INT0_Raising) ? TRUE : FALSE);
+
 	/*activate external interrupt 0 interrupt enable*/
 	GENERAL_INTERRUPT_CONTROL_REGISTER = (GENERAL_INTERRUPT_CONTROL_REGISTER & 0XBF) | (1<<EXTRNAL_INTERRUPT0_ENABL_BIT);
 
@@ -149,6 +284,10 @@ void INT1_Init(const INT1_ConfigType * INT1_config_PTR)
 	MCU_CONTROL_REGISTER = (MCU_CONTROL_REGISTER & 0XF3) |
 			( (INT1_config_PTR->INT1_senseControl)<< INTERRUPT1_SENSE_CONTROL_BITS_SHIFT_VALUE);
 
+	/*configure the lock out of interrupt 1 and clear its edge counters*/
+	INT_setLockout(INT1_ID, INT1_config_PTR->INT1_lockoutTicks,
+			(INT1_config_PTR->INT1_senseControl != INT1_Raising) ? TRUE : FALSE);
+
 	/*active external interrupt interrupt enable for interrupt 1*/
 	GENERAL_INTERRUPT_CONTROL_REGISTER = (GENERAL_INTERRUPT_CONTROL_REGISTER & 0X7F) | (1<<EXTRNAL_INTERRUPT1_ENABL_BIT);
 }
@@ -186,6 +325,10 @@ void INT2_Init(const INT2_ConfigType * INT2_config_PTR)
 	MCU_CONTROL_AND_STATUS_REGISTER = (MCU_CONTROL_AND_STATUS_REGISTER & 0XBF) |
 			                  ( ((INT2_config_PTR->INT2_senseControl) & 0X01)<< INTERRUPT_SENSE_CONTROL_2);
 
+	/*configure the lock out of interrupt 2 and clear its edge counters*/
+	INT_setLockout(INT2_ID, INT2_config_PTR->INT2_lockoutTicks,
+			(INT2_config_PTR->INT2_senseControl != INT2_Raising) ? TRUE : FALSE);
+
 	/*Active external interrupt interrupt enable*/
 	GENERAL_INTERRUPT_CONTROL_REGISTER = (GENERAL_INTERRUPT_CONTROL_REGISTER & 0XCF) | (1<<EXTRNAL_INTERRUPT2_ENABL_BIT);
 }
@@ -209,8 +352,8 @@ void INT2_Init(const INT2_ConfigType * INT2_config_PTR)
  ***************************************************************************************************/
 void INT0_setCallBack(void(*INT0_ptr)(void))
 {
-	/* Save the address of the Call back function in a global variable */
-	g_INT0_callBackPtr = INT0_ptr;
+	/* Set the call back function of the vector, called directly by the ISR */
+	IsrDispatch_setCallBack(&g_INT_subscribers[INT0_ID], INT0_ptr);
 
 }
 /***************************************************************************************************
@@ -231,8 +374,8 @@ void INT0_setCallBack(void(*INT0_ptr)(void))
  ***************************************************************************************************/
 void INT1_setCallBack(void(*INT1_ptr)(void))
 {
-	/* Save the address of the Call back function in a global variable */
-	g_INT1_callBackPtr = INT1_ptr;
+	/* Set the call back function of the vector, called directly by the ISR */
+	IsrDispatch_setCallBack(&g_INT_subscribers[INT1_ID], INT1_ptr);
 
 }
 /***************************************************************************************************
@@ -253,8 +396,8 @@ void INT1_setCallBack(void(*INT1_ptr)(void))
  ***************************************************************************************************/
 void INT2_setCallBack(void(*INT2_ptr)(void))
 {
-	/* Save the address of the Call back function in a global variable */
-	g_INT2_callBackPtr = INT2_ptr;
+	/* Set the call back function of the vector, called directly by the ISR */
+	IsrDispatch_setCallBack(&g_INT_subscribers[INT2_ID], INT2_ptr);
 
 }
 /***************************************************************************************************
@@ -279,6 +422,9 @@ void INT0_DeInit(void)
 	MCU_CONTROL_REGISTER = (MCU_CONTROL_REGISTER & 0XFC);
 	GENERAL_INTERRUPT_CONTROL_REGISTER = (GENERAL_INTERRUPT_CONTROL_REGISTER & 0XBF);
 
+
+	/*no lock out in progress after DeInit*/
+	g_INT_quietTicksLeft[INT0_ID] = 0;
 }
 /***************************************************************************************************
  * [Function Name]: INT1_DeInit
@@ -301,6 +447,9 @@ void INT1_DeInit(void)
 	MCU_CONTROL_REGISTER = (MCU_CONTROL_REGISTER & 0XF3);
 
 	GENERAL_INTERRUPT_CONTROL_REGISTER = (GENERAL_INTERRUPT_CONTROL_REGISTER & 0X7F);
+
+	/*no lock out in progress after DeInit*/
+	g_INT_quietTicksLeft[INT1_ID] = 0;
 }
 /***************************************************************************************************
  * [Function Name]: INT2_DeInit
@@ -323,6 +472,9 @@ void INT2_DeInit(void)
 	MCU_CONTROL_AND_STATUS_REGISTER = (MCU_CONTROL_AND_STATUS_REGISTER & 0XBF);
 
 	GENERAL_INTERRUPT_CONTROL_REGISTER = (GENERAL_INTERRUPT_CONTROL_REGISTER & 0XCF);
+
+	/*no lock out in progress after DeInit*/
+	g_INT_quietTicksLeft[INT2_ID] = 0;
 }
 /***************************************************************************************************
  * [Function Name]: INT0_changeInterrupt_senseControl
@@ -384,4 +536,139 @@ void INT2_changeInterrupt_senseControl(Interrupt2_senseControl INT2SenseControl)
 	MCU_CONTROL_AND_STATUS_REGISTER = (MCU_CONTROL_AND_STATUS_REGISTER & 0XBF) |
 			                                ( (INT2SenseControl & 0X01) << INTERRUPT_SENSE_CONTROL_2);
 }
+/***************************************************************************************************
+ * [Function Name]: INT_subscribe
+ *
+ * [Description]:  Function to add a handler called from one external interrupt vector, every
+ *                 vector has its own list of ISR_DISPATCH_MAX_SUBSCRIBERS handlers
+ *
+ * [Args]:         a_id, a_handler, a_context
+ *
+ * [In]            a_id:      External interrupt (INT0, INT1, INT2)
+ *                 a_handler: Function called from the ISR with a_context
+ *                 a_context: Pointer passed back to the handler, may be NULL_PTR
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the interrupt is not valid or its list is full
+ ***************************************************************************************************/
+bool INT_subscribe(INT_ID a_id, void (*a_handler)(void *a_context), void *a_context)
+{
+	if(a_id >= INT_VECTORS)
+	{
+		return FALSE;
+	}
+
+	return IsrDispatch_subscribe(&g_INT_subscribers[a_id], a_handler, a_context);
+}
+/***************************************************************************************************
+ * [Function Name]: INT_unsubscribe
+ *
+ * [Description]:  Function to remove a handler added by INT_subscribe
+ *
+ * [Args]:         a_id, a_handler, a_context
+ *
+ * [In]            a_id:      External interrupt (INT0, INT1, INT2)
+ *                 a_handler: Function given to INT_subscribe
+ *                 a_context: Context given to INT_subscribe
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void INT_unsubscribe(INT_ID a_id, void (*a_handler)(void *a_context), void *a_context)
+{
+	if(a_id < INT_VECTORS)
+	{
+		IsrDispatch_unsubscribe(&g_INT_subscribers[a_id], a_handler, a_context);
+	}
+}
+/***************************************************************************************************
+ * [Function Name]: INT_lockoutTick
+ *
+ * [Description]:  Function to count the quiet period of the locked out interrupts and enable
+ *                 them again when it ends, called periodically from a timer interrupt, every
+ *                 call counts at most one suppressed edge per interrupt
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void INT_lockoutTick(void)
+{
+	uint8 id;
+
+	for(id = 0; id < INT_VECTORS; id++)
+	{
+		if(g_INT_quietTicksLeft[id] == 0)
+		{
+			continue;
+		}
+
+		if(BIT_IS_SET(GENERAL_INTERRUPT_FLAG_REGISTER, g_INT_flagBit[id]))
+		{
+			/*
+			 * A bounce came in this tick, drop it and start the quiet period again
+			 */
+			GENERAL_INTERRUPT_FLAG_REGISTER = (1<<g_INT_flagBit[id]);
+			g_INT_suppressedEdges[id]++;
+			g_INT_quietTicksLeft[id] = g_INT_lockoutTicks[id];
+		}
+		else if(INT_isReleased((INT_ID)id) == FALSE)
+		{
+			/*
+			 * The button is still held (or bouncing low), the quiet period
+			 * starts when it is released
+			 */
+			g_INT_quietTicksLeft[id] = g_INT_lockoutTicks[id];
+		}
+		else
+		{
+			g_INT_quietTicksLeft[id]--;
+			if(g_INT_quietTicksLeft[id] == 0)
+			{
+				/*
+				 * Released and quiet for the whole period, enable the interrupt for the next press
+				 */
+				GENERAL_INTERRUPT_CONTROL_REGISTER = SET_BIT(GENERAL_INTERRUPT_CONTROL_REGISTER, g_INT_enableBit[id]);
+			}
+		}
+	}
+}
+/***************************************************************************************************
+ * [Function Name]: INT_getEdgeCounts
+ *
+ * [Description]:  Function to read the edges accepted and suppressed by an external interrupt
+ *                 since its Init, for diagnostics
+ *
+ * [Args]:         a_id, a_accepted_PTR, a_suppressed_PTR
+ *
+ * [In]            a_id: External interrupt (INT0, INT1, INT2)
+ *
+ * [Out]           a_accepted_PTR:   Edges which called the handlers
+ *                 a_suppressed_PTR: Edges dropped in the lock out quiet period
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void INT_getEdgeCounts(INT_ID a_id, uint16 *a_accepted_PTR, uint16 *a_suppressed_PTR)
+{
+	uint8 sreg = SREG_REG;
+
+	if(a_id >= INT_VECTORS)
+	{
+		return;
+	}
+
+	/*
+	 * 16-bit counters written by the interrupts, read them with the interrupts disabled
+	 */
+	SREG_REG = CLEAR_BIT(SREG_REG, I_BIT);
+	*a_accepted_PTR = g_INT_acceptedEdges[a_id];
+	*a_suppressed_PTR = g_INT_suppressedEdges[a_id];
+	SREG_REG = sreg;
+}
 /***************************************************************************************************/
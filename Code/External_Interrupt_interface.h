@@ -13,6 +13,7 @@
 #define EXTERNAL_INTERRUPT_INTERFACE_H_
 
 #include"External_Interrupt_private.h"
+#include"isr_dispatch.h"
 #include<avr/io.h>
 
 
@@ -43,6 +44,16 @@
 #define EXTRNAL_INTERRUPT2_ENABL_BIT            INT2_BIT
 
 
+/*
+ * Lock out mode: an accepted edge masks its interrupt enable bit in GICR, the
+ * edges which come while it is masked are bounces, they set the flag only and
+ * are counted as suppressed by INT_lockoutTick, the interrupt is enabled again
+ * after INTx_lockoutTicks calls of INT_lockoutTick which all found the pin
+ * released (high, low for a raising edge) and no edge, so a held button and
+ * the bounce of its release never give a second press
+ */
+#define INT_LOCKOUT_DISABLED                    0
+
 #define INTERRUPT0_DIRECTION_PORT              DDRD
 #define INTERRUPT1_DIRECTION_PORT              DDRD
 #define INTERRUPT2_DIRECTION_PORT              DDRB
@@ -51,6 +62,10 @@
 #define INTERRUPT1_DATA_PORT                   PORTD
 #define INTERRUPT2_DATA_PORT                   PORTB
 
+#define INTERRUPT0_INPUT_PORT                  PIND
+#define INTERRUPT1_INPUT_PORT                  PIND
+#define INTERRUPT2_INPUT_PORT                  PINB
+
 #define INTERRUPT0_PIN                         PD2
 #define INTERRUPT1_PIN                         PD3
 #define INTERRUPT2_PIN                         PB2
@@ -93,6 +108,7 @@ INT2_Low_level, INT2_Any_logical, INT2_Falling, INT2_Raising
 typedef struct
 {
 	Interrupt0_senseControl INT0_senseControl;
+	uint8 INT0_lockoutTicks; /* 0 --> every edge is accepted */
 
 }INT0_ConfigType;
 
@@ -102,6 +118,7 @@ typedef struct
 typedef struct
 {
 	Interrupt1_senseControl INT1_senseControl;
+	uint8 INT1_lockoutTicks; /* 0 --> every edge is accepted */
 
 }INT1_ConfigType;
 /**************************************************************************
@@ -110,8 +127,18 @@ typedef struct
 typedef struct
 {
 	Interrupt2_senseControl INT2_senseControl;
+	uint8 INT2_lockoutTicks; /* 0 --> every edge is accepted */
 
 }INT2_ConfigType;
+
+/*
+ * External interrupt vectors, each one has its own subscribers list
+ */
+typedef enum
+{
+	INT0_ID, INT1_ID, INT2_ID, INT_VECTORS
+}INT_ID;
+
 /***************************************************************************************************
  * [Function Name]: INT0_Init
  *
@@ -301,6 +328,71 @@ void INT1_changeInterrupt_senseControl(Interrupt1_senseControl INT1SenseControl)
  * [Returns]:      NONE
  ***************************************************************************************************/
 void INT2_changeInterrupt_senseControl(Interrupt2_senseControl INT2SenseControl);
+/***************************************************************************************************
+ * [Function Name]: INT_subscribe
+ *
+ * [Description]:  Function to add a handler called from one external interrupt vector, every
+ *                 vector has its own list of ISR_DISPATCH_MAX_SUBSCRIBERS handlers
+ *
+ * [Args]:         a_id, a_handler, a_context
+ *
+ * [In]            a_id:      External interrupt (INT0, INT1, INT2)
+ *                 a_handler: Function called from the ISR with a_context
+ *                 a_context: Pointer passed back to the handler, may be NULL_PTR
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the interrupt is not valid or its list is full
+ ***************************************************************************************************/
+bool INT_subscribe(INT_ID a_id, void (*a_handler)(void *a_context), void *a_context);
+/***************************************************************************************************
+ * [Function Name]: INT_unsubscribe
+ *
+ * [Description]:  Function to remove a handler added by INT_subscribe
+ *
+ * [Args]:         a_id, a_handler, a_context
+ *
+ * [In]            a_id:      External interrupt (INT0, INT1, INT2)
+ *                 a_handler: Function given to INT_subscribe
+ *                 a_context: Context given to INT_subscribe
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void INT_unsubscribe(INT_ID a_id, void (*a_handler)(void *a_context), void *a_context);
+/***************************************************************************************************
+ * [Function Name]: INT_lockoutTick
+ *
+ * [Description]:  Function to count the quiet period of the locked out interrupts and enable
+ *                 them again when it ends, the period starts again on any edge or while the
+ *                 pin is not released, called periodically from a timer interrupt, every
+ *                 call counts at most one suppressed edge per interrupt
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void INT_lockoutTick(void);
+/***************************************************************************************************
+ * [Function Name]: INT_getEdgeCounts
+ *
+ * [Description]:  Function to read the edges accepted and suppressed by an external interrupt
+ *                 since its Init, for diagnostics
+ *
+ * [Args]:         a_id, a_accepted_PTR, a_suppressed_PTR
+ *
+ * [In]            a_id: External interrupt (INT0, INT1, INT2)
+ *
+ * [Out]           a_accepted_PTR:   Edges which called the handlers
+ *                 a_suppressed_PTR: Edges dropped in the lock out quiet period
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void INT_getEdgeCounts(INT_ID a_id, uint16 *a_accepted_PTR, uint16 *a_suppressed_PTR);
 /***************************************************************************************************/
-
 #endif /* EXTERNAL_INTERRUPT_INTERFACE_H_ */
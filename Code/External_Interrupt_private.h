@@ -17,6 +17,7 @@
 #define MCUCSR_REG             (*( (volatile uint8 *)(0X54) ) )
 #define GICR_REG               (*( (volatile uint8 *)(0X5B) ) )
 #define GIFR_REG               (*( (volatile uint8 *)(0X5A) ) )
+#define SREG_REG               (*( (volatile uint8 *)(0X5F) ))
 
 
 #define ISC00_BIT                       0
@@ -34,6 +35,8 @@
 #define INTF1_BIT                       7
 #define INTF2_BIT                       5
 
+#define I_BIT                           7
+
 
 
 #define INT0_vect               __vector_1
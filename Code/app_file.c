@@ -9,62 +9,146 @@
  ***********************************************************************************/
 
 #include"app_file.h"
+#include<stddef.h>
+#include<avr/pgmspace.h>
+
+/*
+ * Digits of the Set Clock State in the order of the cursor, Right/Left
+ * move along the table so the colons are never selected
+ */
+static const Clock_FieldType g_clockFields[CLOCK_EDIT_FIELDS] PROGMEM =
+{
+	/*column                field                                 shift              min max fieldMax  rule*/
+	{HOUR_TENS_COLUMN,      offsetof(Clock_TimeType, hours),      TENS_DIGIT_SHIFT,  0,  2,  0X23,     FIELD_WRAP},
+	{HOUR_UNITS_COLUMN,     offsetof(Clock_TimeType, hours),      UNITS_DIGIT_SHIFT, 0,  9,  0X23,     FIELD_WRAP},
+	{MINUTES_TENS_COLUMN,   offsetof(Clock_TimeType, minutes),    TENS_DIGIT_SHIFT,  0,  5,  0X59,     FIELD_WRAP},
+	{MINUTES_UNITS_COLUMN,  offsetof(Clock_TimeType, minutes),    UNITS_DIGIT_SHIFT, 0,  9,  0X59,     FIELD_WRAP},
+	{SECONDS_TENS_COLUMN,   offsetof(Clock_TimeType, seconds),    TENS_DIGIT_SHIFT,  0,  5,  0X59,     FIELD_WRAP},
+	{SECONDS_UNITS_COLUMN,  offsetof(Clock_TimeType, seconds),    UNITS_DIGIT_SHIFT, 0,  9,  0X59,     FIELD_WRAP}
+};
+
+/***************************************************************************************************
+ * [Function Name]: incrementBCD
+ *
+ * [Description]:  Function to increment a packed BCD field of the clock digit by digit
+ *                 without any division
+ *
+ * [Args]:         field, maximum, unitsChangedBit, changeMask
+ *
+ * [In]            field: Pointer to the packed BCD field (seconds, minutes or hours)
+ *                 maximum: Packed BCD value at which the field starts from 0 again
+ *                 unitsChangedBit: Change mask bit of the units digit of the field,
+ *                                  the tens digit bit is the next bit
+ *
+ * [Out]           changeMask: The bits of the changed digits are added to it
+ *
+ * [Returns]:      TRUE if the field wrapped to 0 and carries to the next field
+ ***************************************************************************************************/
+static bool incrementBCD(uint8 *field, uint8 maximum, uint8 unitsChangedBit, uint8 *changeMask)
+{
+	uint8 value = (*field) + 1;
+
+	/*
+	 * The units digit changes every increment
+	 */
+	(*changeMask) |= unitsChangedBit;
+
+	/*
+	 * Carry from units to tens, 0xX9 + 1 = 0xXA --> 0x(X+1)0
+	 */
+	if(UNITS(value) == BCD_DIGIT_LIMIT)
+	{
+		value += BCD_DIGIT_ADJUST;
+		(*changeMask) |= (uint8)(unitsChangedBit << 1);
+	}
+
+	/*
+	 * Wrap the field to 0 and carry to the next field
+	 */
+	if(value >= maximum)
+	{
+		(*field) = INITIAL_COUNT;
+		(*changeMask) |= (uint8)(unitsChangedBit | (unitsChangedBit << 1));
+		return TRUE;
+	}
+
+	(*field) = value;
+	return FALSE;
+}
 
 /***************************************************************************************************
  * [Function Name]: display
  *
  * [Description]:  Function to display the time of the clock
  *
- * [Args]:         NONE
+ * [Args]:         time, changeMask
  *
- * [In]            NONE
+ * [In]            time: Pointer to the time to display
+ *                 changeMask: Mask of the digits to redraw (xxx_CHANGED bits),
+ *                             ALL_DIGITS_CHANGED redraws the commas too
  *
  * [Out]           NONE
  *
  * [Returns]:      NONE
  ***************************************************************************************************/
-void display(void)
+void display(const Clock_TimeType *time, uint8 changeMask)
 {
 	/*
-	 * Force the LCD to hide the cursor while displaying the CLOCK
+	 * The cursor is left as it is, the main loop shows or hides it
+	 * with the state, so a step of the edited time does not blink it
 	 */
-	LCD_sendCommand(HIDE_CURSOR_COMMAND);
 
 	/*
 	 * Part which responsible to display the digits of hour
+	 * only the digits in the change mask are written to the LCD frame buffer
 	 */
-	LCD_goToRowColumn(DIGITAL_CLOCK_ROW,HOUR_TENS_COLUMN);
-	LCD_intgerToString( TENS(g_hours) );
-	LCD_goToRowColumn(DIGITAL_CLOCK_ROW,HOUR_UNITS_COLUMN);
-	LCD_intgerToString( UNITS(g_hours) );
+	if(changeMask & HOURS_TENS_CHANGED)
+	{
+		LCD_bufferDigit(DIGITAL_CLOCK_ROW, HOUR_TENS_COLUMN, TENS(time->hours));
+	}
+	if(changeMask & HOURS_UNITS_CHANGED)
+	{
+		LCD_bufferDigit(DIGITAL_CLOCK_ROW, HOUR_UNITS_COLUMN, UNITS(time->hours));
+	}
 
 	/*
-	 * Part which responsible to display first comma between hours and minutes
+	 * Part which responsible to display the commas, they never change
+	 * so they are written only with a full redraw
 	 */
-	LCD_goToRowColumn(DIGITAL_CLOCK_ROW, FIRST_COMMA_COLUMN);
-	LCD_displayCharacter(':');
+	if(changeMask == ALL_DIGITS_CHANGED)
+	{
+		LCD_bufferCharacter(DIGITAL_CLOCK_ROW, FIRST_COMMA_COLUMN, ':');
+		LCD_bufferCharacter(DIGITAL_CLOCK_ROW, SECOND_COMMA_COLUMN, ':');
+	}
 
 	/*
 	 * Part which responsible to display the digits of minutes
 	 */
-	LCD_goToRowColumn(DIGITAL_CLOCK_ROW, MINUTES_TENS_COLUMN);
-	LCD_intgerToString( TENS(g_minutes) );
-	LCD_goToRowColumn(DIGITAL_CLOCK_ROW, MINUTES_UNITS_COLUMN);
-	LCD_intgerToString( UNITS(g_minutes) );
+	if(changeMask & MINUTES_TENS_CHANGED)
+	{
+		LCD_bufferDigit(DIGITAL_CLOCK_ROW, MINUTES_TENS_COLUMN, TENS(time->minutes));
+	}
+	if(changeMask & MINUTES_UNITS_CHANGED)
+	{
+		LCD_bufferDigit(DIGITAL_CLOCK_ROW, MINUTES_UNITS_COLUMN, UNITS(time->minutes));
+	}
 
 	/*
-	 * Part which responsible to display second comma between minutes and seconds
+	 * Part which responsible to display the digits of seconds
 	 */
-	LCD_goToRowColumn(DIGITAL_CLOCK_ROW, SECOND_COMMA_COLUMN);
-	LCD_displayCharacter(':');
+	if(changeMask & SECONDS_TENS_CHANGED)
+	{
+		LCD_bufferDigit(DIGITAL_CLOCK_ROW, SECONDS_TENS_COLUMN, TENS(time->seconds));
+	}
+	if(changeMask & SECONDS_UNITS_CHANGED)
+	{
+		LCD_bufferDigit(DIGITAL_CLOCK_ROW, SECONDS_UNITS_COLUMN, UNITS(time->seconds));
+	}
 
 	/*
-	 * Part which responsible to display the digits of seconds
+	 * Send the changed cells only to the LCD
 	 */
-	LCD_goToRowColumn(DIGITAL_CLOCK_ROW, SECONDS_TENS_COLUMN);
-	LCD_intgerToString( TENS(g_seconds) );
-	LCD_goToRowColumn(DIGITAL_CLOCK_ROW, SECONDS_UNITS_COLUMN);
-	LCD_intgerToString( UNITS(g_seconds) );
+	LCD_flush();
 }
 /***************************************************************************************************
  * [Function Name]: DigitalClock
@@ -77,101 +161,74 @@ void display(void)
  *
  * [Out]           NONE
  *
- * [Returns]:      NONE
+ * [Returns]:      Mask of the digits changed by this call (xxx_CHANGED bits),
+ *                 the carry from units to tens and from field to field is included
  ***************************************************************************************************/
-void DigitalClock(void)
+uint8 DigitalClock(void)
 {
 	/*
-	 * Check if the interrupt of the Timer1 happen or not
+	 * local variable to collect the digits changed by this tick
 	 */
-	if (g_tick == TRUE)
-	{
-		/*
-		 * Increment the seconds of the StopWatch
-		 */
-		g_seconds++;
-		/*
-		 * Check if 1 minute passed or not if yes increment
-		 *minutes1 and start the seconds to increment
-		 * from 0 again
-		 */
-		if(g_seconds >= MAXIMUM_SECONDS)
-		{
-
-			/*
-			 * clear the variable of seconds to begin from start again
-			 * indicate that 1 minute passed
-			 */
-			g_seconds= INITIAL_COUNT;
-			/*
-			 * Increment variable of minutes to start appear on
-			 * the 7 segments, incrementing every 60 seconds
-			 */
-			g_minutes++;
-
-		}/*End of seconds condition*/
-
-
-		/*
-		 * Check if 1 hour passed or not if yes increment hours 1
-		 * and start the Minutes & Seconds to increment from 0 again
-		 */
-		if(g_minutes >= MAXIMUM_MINUTES)
-		{
-
-			/*
-			 * clear the variable of seconds to begin from start again
-			 * indicate that 1 minute passed
-			 */
-			g_seconds = INITIAL_COUNT;
-			/*
-			 * clear the variable of minutes to begin from start again
-			 * indicate that 1 hour passed
-			 */
-			g_minutes = INITIAL_COUNT;
-			/*
-			 * Increment variable of hours to start appear on
-			 * the 7 segments, incrementing every 60 minutes
-			 */
-			g_hours++;
-
-		}/*end of minutes condition*/
+	uint8 changeMask = NO_DIGIT_CHANGED;
 
+	/*
+	 * Number of the Timer1 interrupts not added to the clock yet,
+	 * more than one if the main loop was busy for more than a second
+	 */
+	uint8 pendingTicks = (uint8)(g_tickCount - g_processedTicks);
 
+	/*
+	 * Catch up on all the pending seconds in one pass
+	 */
+	while(pendingTicks != INITIAL_COUNT)
+	{
 		/*
-		 * Check if 1 hour passed or not if yes increment hours 1
-		 *and start the Minutes & Seconds hours to increment from 0 again
-		 *and this condition is true every 1000 melly seconds
+		 * Increment the seconds, if 1 minute passed increment the minutes
+		 * and if 1 hour passed increment the hours, every field starts
+		 * from 0 again when it reaches its maximum value
 		 */
-
-		if(g_hours >= MAXIMUM_HOURS)
+		if(incrementBCD(&g_time.seconds, MAXIMUM_SECONDS, SECONDS_UNITS_CHANGED, &changeMask) == TRUE)
 		{
-
-			/*
-			 * clear the variable of seconds to begin from start again
-			 * indicate that 1 minute passed
-			 */
-			g_seconds = INITIAL_COUNT;
-			/*
-			 * clear the variable of minutes to begin from start again
-			 * indicate that 1 hour passed
-			 */
-			g_minutes = INITIAL_COUNT;
-			/*
-			 * clear the variable of minutes to begin from start again
-			 * indicate that 1 day passed
-			 */
-			g_hours = INITIAL_COUNT;
+			if(incrementBCD(&g_time.minutes, MAXIMUM_MINUTES, MINUTES_UNITS_CHANGED, &changeMask) == TRUE)
+			{
+				incrementBCD(&g_time.hours, MAXIMUM_HOURS, HOURS_UNITS_CHANGED, &changeMask);
+			}
 		}
 
 		/*
-		 * Return the value of tick to be 0 again to be
-		 * ready for the next
+		 * Mark the tick as processed so the tick callback
+		 * sees the free room immediately
 		 */
-		g_tick = FALSE;
+		g_processedTicks++;
+		pendingTicks--;
+	}
 
-	}/*end of first if statement*/
+	return changeMask;
+}
+/***************************************************************************************************
+ * [Function Name]: commitEditTime
+ *
+ * [Description]:  Function to copy the edited time to the clock when the Set Clock State ends,
+ *                 the current second starts again at the commit so the next tick comes
+ *                 one full second later, the ticks not processed yet are dropped
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void commitEditTime(void)
+{
+	uint8 sreg = SREG;
 
+	cli();
+	g_time = g_editTime;
+	CLOCK_REALIGN();
+	g_processedTicks = g_tickCount;
+	SREG = sreg;
 }
 /***************************************************************************************************
  * [Function Name]: tick
@@ -188,13 +245,16 @@ void DigitalClock(void)
  ***************************************************************************************************/
 void tick(void)
 {
-	/*Change the state of the tick variable to know that the time interrupt has occurred*/
-	g_tick = TRUE;
+	/*
+	 * Same counting as the compile time bound handler of the clock interrupt
+	 */
+	CLOCK_TICK_HOOK();
 }
 /***************************************************************************************************
- * [Function Name]: Right
+ * [Function Name]: getLostTicks
  *
- * [Description]:  Call back function of Interrupt 0 which responsible for right button
+ * [Description]:  Function to read the number of the ticks lost because the main loop
+ *                 did not process them in time, for diagnostics
  *
  * [Args]:         NONE
  *
@@ -202,61 +262,226 @@ void tick(void)
  *
  * [Out]           NONE
  *
- * [Returns]:      NONE
+ * [Returns]:      Number of the lost ticks
  ***************************************************************************************************/
-void Right(void)
+uint16 getLostTicks(void)
 {
+	uint16 lostTicks;
+	uint8 sreg = SREG;
+
 	/*
-	 * Stop the timer if Right button has pressed as that
-	 * indicates system into Set Clock State
+	 * 16-bit variable written by the interrupt, read it with the interrupts disabled
 	 */
-	Timer1_Stop();
+	cli();
+	lostTicks = g_lostTicks;
+	SREG = sreg;
+
+	return lostTicks;
+}
+/***************************************************************************************************
+ * [Function Name]: systemTick
+ *
+ * [Description]:  Call back function of Timer0 (~1ms) which sends the next queued LCD byte,
+ *                 advances the software timers, ends the lock out of the Right/Left/OK
+ *                 interrupts and samples whether the CPU was awake to measure the duty cycle
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void systemTick(void)
+{
+	/* same work as the Timer0 hook of isr_hooks_config.h */
+	SYSTEM_TICK_HOOK();
+}
+/***************************************************************************************************
+ * [Function Name]: sleepUntilInterrupt
+ *
+ * [Description]:  Function to put the CPU in sleep until the next interrupt if the main loop
+ *                 has nothing to do, the check and the sleep are done with the interrupts
+ *                 disabled so a tick can not slip in between them
+ *
+ * [Args]:         pendingDigits
+ *
+ * [In]            pendingDigits: digits changed but not displayed yet
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void sleepUntilInterrupt(uint8 pendingDigits)
+{
+	uint8 sleepMode = SLEEP_MODE_IDLE;
+
+	cli();
+
 	/*
-	 * Change the State of OK button that to enter Set Clock State
+	 * A deferred software timer call back a button press or release or a posted event waits for the main loop
 	 */
-	g_OK = FALSE;
+	if((SoftTimer_isPending() == TRUE) || (Button_isEventPending() == TRUE) ||
+			(EventQueue_isEmpty() == FALSE))
+	{
+		sei();
+		return;
+	}
+
 	/*
-	 * Increment the position of the cursor to go right
-	 * in every increment "Every right button press"
+	 * A tick not added to the clock yet, the clock counts in both states
 	 */
-	g_cursorPosition++;
+	if(g_tickCount != g_processedTicks)
+	{
+		sei();
+		return;
+	}
 
+	if(g_OK == TRUE)
+	{
+		/*
+		 * Work left: a frame which can be rendered now because the LCD queue is empty
+		 */
+		if((pendingDigits != NO_DIGIT_CHANGED) && (LCD_isFlushComplete() == TRUE))
+		{
+			sei();
+			return;
+		}
+#if ((CLOCK_TICK_SOURCE == CLOCK_TICK_SOURCE_RTC) && (CLOCK_SLEEP_POWER_SAVE == TRUE))
+		/*
+		 * Nothing to send to the LCD, only the RTC has to run until the next second
+		 */
+		if(LCD_isFlushComplete() == TRUE)
+		{
+			Timer2_RTC_prepareSleep();
+			sleepMode = SLEEP_MODE_PWR_SAVE;
+		}
+#endif
+	}
 	/*
-	 * Conditions to handle the cursor position
-	 * to prevent the cursor from pointing at Commas
-	 * or pointing at any position except clock digits
+	 * In the Set Clock State the buttons are sampled by the Timer0
+	 * tick, which wakes the CPU up, so the repeat of a held button is
+	 * checked at least every tick
 	 */
 
+	set_sleep_mode(sleepMode);
+	sleep_enable();
+	g_cpuAwake = FALSE;
 	/*
-	 * Force the position of cursor to go for first minutes digit
-	 * if it is the first comma position
+	 * The instruction after sei is always executed before any pending
+	 * interrupt, so an interrupt which comes now wakes the CPU up
 	 */
-	if(g_cursorPosition == (FIRST_COMMA_COLUMN + 1) )
-	{
-		g_cursorPosition = (MINUTES_TENS_COLUMN + 1);
-	}
+	sei();
+	sleep_cpu();
+	sleep_disable();
+	g_cpuAwake = TRUE;
+}
+/***************************************************************************************************
+ * [Function Name]: getDutyCycle
+ *
+ * [Description]:  Function to read the awake fraction of the CPU measured in the last
+ *                 complete window of DUTY_CYCLE_WINDOW Timer0 ticks, Timer0 does not run
+ *                 in power-save sleep so that time is not part of the measurement
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Number of awake ticks per DUTY_CYCLE_WINDOW ticks
+ ***************************************************************************************************/
+uint16 getDutyCycle(void)
+{
+	uint16 dutyCycle;
+	uint8 sreg = SREG;
+
 	/*
-	 * Force the position of cursor to go for first seconds digit
-	 * if it is the second comma position
+	 * 16-bit variable written by the interrupt, read it with the interrupts disabled
 	 */
-	else if(g_cursorPosition == (SECOND_COMMA_COLUMN+1) )
+	cli();
+	dutyCycle = g_lastDutyCycle;
+	SREG = sreg;
+
+	return dutyCycle;
+}
+/***************************************************************************************************
+ * [Function Name]: startEditing
+ *
+ * [Description]:  Function to enter the Set Clock State, the first time it takes the copy of
+ *                 the time to edit and shows it, the clock itself is not displayed while editing
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static void startEditing(void)
+{
+	if(g_OK == TRUE)
 	{
-		g_cursorPosition =  (SECONDS_TENS_COLUMN + 1) ;
+		g_editTime = g_time;
+		display(&g_editTime, ALL_DIGITS_CHANGED);
 	}
 	/*
-	 * Force the position of cursor to go for first hours digit
-	 * if it is the end of clock digits position
+	 * Change the State of OK button that to enter Set Clock State
 	 */
-	else if (g_cursorPosition == (END_OF_CLOCK_COLUMN + 1))
+	g_OK = FALSE;
+}
+/***************************************************************************************************
+ * [Function Name]: handleEvent
+ *
+ * [Description]:  Function to handle one button event in the main loop, all the state of the
+ *                 clock setting is changed here so the interrupts only post the events
+ *
+ * [Args]:         a_event
+ *
+ * [In]            a_event: Event taken from the event queue or from the UP/DOWN buttons
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Mask of the digits to redraw in the Default State
+ ***************************************************************************************************/
+uint8 handleEvent(Event_Type a_event)
+{
+	uint8 changeMask = NO_DIGIT_CHANGED;
+
+	switch(a_event)
 	{
-		g_cursorPosition = (HOUR_TENS_COLUMN + 1);
+	case EVENT_RIGHT:
+		Right();
+		break;
+	case EVENT_LEFT:
+		Left();
+		break;
+	case EVENT_OK:
+		changeMask = OK_FUNC();
+		break;
+	case EVENT_UP:
+	case EVENT_DOWN:
+		/*
+		 * UP and DOWN change the edited time in the Set Clock State only
+		 */
+		if(g_OK == FALSE)
+		{
+			stepDigit((a_event == EVENT_UP) ? DIGIT_UP : DIGIT_DOWN);
+			display(&g_editTime, ALL_DIGITS_CHANGED);
+		}
+		break;
+	default:
+		break;
 	}
 
+	return changeMask;
 }
 /***************************************************************************************************
- * [Function Name]: Left
+ * [Function Name]: postRight
  *
- * [Description]:  Call back function of Interrupt 1 which responsible for left button
+ * [Description]:  Call back function of Interrupt 0, posts the right button event
  *
  * [Args]:         NONE
  *
@@ -266,57 +491,106 @@ void Right(void)
  *
  * [Returns]:      NONE
  ***************************************************************************************************/
-void Left(void)
+void postRight(void)
+{
+	EVENT_QUEUE_POST(EVENT_RIGHT);
+}
+/***************************************************************************************************
+ * [Function Name]: postLeft
+ *
+ * [Description]:  Call back function of Interrupt 1, posts the left button event
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void postLeft(void)
+{
+	EVENT_QUEUE_POST(EVENT_LEFT);
+}
+/***************************************************************************************************
+ * [Function Name]: postOK
+ *
+ * [Description]:  Call back function of Interrupt 2, posts the OK button event
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void postOK(void)
+{
+	EVENT_QUEUE_POST(EVENT_OK);
+}
+/***************************************************************************************************
+ * [Function Name]: Right
+ *
+ * [Description]:  Handler of the right button event (Interrupt 0), runs in the main loop
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Right(void)
 {
 	/*
-	 * Stop the timer if Right button has pressed as that
-	 * indicates system into Set Clock State
-	 */
-	Timer1_Stop();
-	/*
-	 * Change the State of OK button that to enter Set Clock State
-	 */
-	g_OK = FALSE;
-	/*
-	 * Decrement the position of the cursor to go left
-	 * in every decrement "Every left button press"
-	 */
-	g_cursorPosition--;
-	/*
-	 * Conditions to handle the cursor position
-	 * to prevent the cursor from pointing at Commas
-	 * or pointing at any position except clock digits
+	 * Enter Set Clock State with a copy of the time to edit
 	 */
-
+	startEditing();
 	/*
-	 * Force the position of cursor to go to stop at first element
-	 * if the position at first hour digit
+	 * Select the next digit of the field table, after the
+	 * last digit the cursor goes back to the first one
 	 */
-	if(g_cursorPosition <= HOUR_TENS_COLUMN)
+	g_cursorPosition++;
+	if(g_cursorPosition >= CLOCK_EDIT_FIELDS)
 	{
-		g_cursorPosition = (HOUR_TENS_COLUMN + 1);
+		g_cursorPosition = 0;
 	}
+}
+/***************************************************************************************************
+ * [Function Name]: Left
+ *
+ * [Description]:  Handler of the left button event (Interrupt 1), runs in the main loop
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Left(void)
+{
 	/*
-	 * Force the position of cursor to go for units of hour digit
-	 * if it is the first comma position
+	 * Enter Set Clock State with a copy of the time to edit
 	 */
-	else if(g_cursorPosition == (FIRST_COMMA_COLUMN + 1) )
-	{
-		g_cursorPosition = HOUR_UNITS_COLUMN + 1;
-	}
+	startEditing();
 	/*
-	 * Force the position of cursor to go for units of minutes digit
-	 * if it is the end of clock digits position
+	 * Select the previous digit of the field table,
+	 * the cursor stops at the first digit
 	 */
-	else if(g_cursorPosition == (SECOND_COMMA_COLUMN + 1) )
+	g_cursorPosition--;
+	if(g_cursorPosition < 0)
 	{
-		g_cursorPosition =  MINUTES_UNITS_COLUMN + 1;
+		g_cursorPosition = 0;
 	}
 }
 /***************************************************************************************************
  * [Function Name]: OK_FUNC
  *
- * [Description]:  Call back function of Interrupt 2 which responsible for OK button
+ * [Description]:  Handler of the OK button event (Interrupt 2), runs in the main loop
  *
  * [Args]:         NONE
  *
@@ -324,14 +598,21 @@ void Left(void)
  *
  * [Out]           NONE
  *
- * [Returns]:      NONE
+ * [Returns]:      Mask of the digits to redraw in the Default State
  ***************************************************************************************************/
-void OK_FUNC(void)
+uint8 OK_FUNC(void)
 {
+	uint8 changeMask = NO_DIGIT_CHANGED;
+
 	/*
-	 * Restart the timer if the OK button is pressed
+	 * Leaving the Set Clock State: the edited time replaces the
+	 * clock and the current second starts again now
 	 */
-	Timer1_Start(F_CPU_1024);
+	if(g_OK == FALSE)
+	{
+		commitEditTime();
+		changeMask = ALL_DIGITS_CHANGED;
+	}
 	/*
 	 * Change the state of OK button to enter the Default State
 	 */
@@ -341,320 +622,122 @@ void OK_FUNC(void)
 	 */
 	g_cursorPosition = INITIAL_POSITION;
 
-
+	return changeMask;
 }
 /***************************************************************************************************
- * [Function Name]: UP_FUNC
+ * [Function Name]: stepDigit
  *
- * [Description]:  Call back function of Interrupt 2 which responsible for UP button
+ * [Description]:  Handler of the UP/DOWN buttons, steps the digit under the cursor of the edited
+ *                 time by one as its descriptor says, the edited field stays between 0 and its
+ *                 maximum so the time is always in 00:00:00 - 23:59:59
  *
- * [Args]:         NONE
+ * [Args]:         a_direction
  *
- * [In]            NONE
+ * [In]            a_direction: DIGIT_UP or DIGIT_DOWN
  *
  * [Out]           NONE
  *
  * [Returns]:      NONE
  ***************************************************************************************************/
-void UP_Func(void)
+void stepDigit(sint8 a_direction)
 {
-	/*local variable to store the units of the hour variable*/
-	sint8 up_hourUnits     = INITIAL_VALUE;
-
-	/*local variable to store the tens of the hour variable*/
-	sint8 up_hourTens      = INITIAL_VALUE;
-
-	/*local variable to store the units of the minutes variable*/
-	sint8 up_minutesUnits  = INITIAL_VALUE;
+	const Clock_FieldType *descriptor;
+	uint8 *field;
+	uint8 shift;
+	uint8 digitMask;
+	uint8 digit;
+	uint8 minimum;
+	uint8 maximum;
+	uint8 fieldMaximum;
+	uint8 value;
+
+	if((g_cursorPosition < 0) || (g_cursorPosition >= CLOCK_EDIT_FIELDS))
+	{
+		return;
+	}
 
-	/*local variable to store the tens of the minutes variable*/
-	sint8 up_minutesTens   = INITIAL_VALUE;
+	descriptor = &g_clockFields[g_cursorPosition];
+	field = (uint8 *)&g_editTime + pgm_read_byte(&descriptor->field);
+	shift = pgm_read_byte(&descriptor->shift);
+	minimum = pgm_read_byte(&descriptor->minimum);
+	maximum = pgm_read_byte(&descriptor->maximum);
+	fieldMaximum = pgm_read_byte(&descriptor->fieldMaximum);
 
-	/*local variable to store the units of the seconds variable*/
-	sint8 up_secondsUnits  = INITIAL_VALUE;
+	digitMask = (uint8)(BCD_DIGIT_MASK << shift);
+	digit = (uint8)(((*field) & digitMask) >> shift);
+	value = (*field) & (uint8)(~digitMask);
 
-	/*local variable to store the tens of the seconds variable*/
-	sint8 up_secondsTens   = INITIAL_VALUE;
-	/**************************************************************************
-	 *                     Handle hours digit Increasing                      *
-	 **************************************************************************/
-	if(g_cursorPosition == (HOUR_TENS_COLUMN + 1) )
+	/*
+	 * When the other digit of the field is at its top the digit can not pass
+	 * the one of the field maximum (hours 2X --> units up to 3)
+	 */
+	if((value == (fieldMaximum & (uint8)(~digitMask))) &&
+			(((fieldMaximum & digitMask) >> shift) < maximum))
 	{
-		/*Store the tens of the hour in the variable*/
-		up_hourTens = TENS(g_hours);
-
-		/*Increase the stored value by one only as this is one press*/
-		up_hourTens++;
+		maximum = (uint8)((fieldMaximum & digitMask) >> shift);
+	}
 
-		/*Condition to prevent the value of tens from increasing if it
-		 * reached the maximum value*/
-		if(up_hourTens == MAXIMUM_HOURS_TENS_UP)
+	if(a_direction == DIGIT_UP)
+	{
+		if(digit < maximum)
 		{
-			/*if it reached the maximum value of tens return the value to initial value*/
-			up_hourTens = INITIAL_VALUE;
+			digit++;
 		}
-
-		/*Overwrite the new value of the hours on the g_hour variable*/
-		g_hours = ( MULTIPLY_BY_TEN(up_hourTens) + UNITS(g_hours) );
-	}
-	else if(g_cursorPosition == (HOUR_UNITS_COLUMN + 1) )
-	{
-		/*Store the units of the hour in the variable*/
-		up_hourUnits = UNITS(g_hours);
-
-		/*Increase the stored value by one only as this is one press*/
-		up_hourUnits++;
-
-		/*Increase the stored value by one only as this is one press*/
-
-		/*Condition to prevent the value of units from increasing if it
-		 * reached the maximum value*/
-		if(up_hourUnits == MAXIMUM_HOURS_UNITS_UP)
+		else if(pgm_read_byte(&descriptor->rule) == FIELD_WRAP)
 		{
-			/*if it reached the maximum value of units return the value to initial value*/
-			up_hourUnits = INITIAL_VALUE;
+			digit = minimum;
 		}
-
-		/*Overwrite the new value of the hours on the g_hour variable*/
-		g_hours = ( ( MULTIPLY_BY_TEN(TENS(g_hours) ) ) + up_hourUnits);
-	}
-	/**************************************************************************
-	 *                   Handle Minutes digit Increasing                      *
-	 **************************************************************************/
-	else if(g_cursorPosition == (MINUTES_TENS_COLUMN + 1))
-	{
-		/*Store the tens of the minutes in the variable*/
-		up_minutesTens = TENS(g_minutes);
-
-		/*Increase the stored value by one only as this is one press*/
-		up_minutesTens++;
-
-		/*Condition to prevent the value of tens from increasing if it
-		 * reached the maximum value*/
-		if(up_minutesTens == MAXIMUM_MINUTES_TENS_UP)
+		else
 		{
-			/*if it reached the maximum value of tens return the value to initial value*/
-			up_minutesTens = INITIAL_VALUE;
+			digit = maximum;
 		}
-
-		/*Overwrite the new value of the hours on the g_minutes variable*/
-		g_minutes = ( MULTIPLY_BY_TEN(up_minutesTens) + UNITS(g_minutes) );
-
 	}
-	else if(g_cursorPosition == (MINUTES_UNITS_COLUMN + 1))
+	else
 	{
-		/*Store the units of the minutes in the variable*/
-		up_minutesUnits = UNITS(g_minutes);
-
-		/*Increase the stored value by one only as this is one press*/
-		up_minutesUnits++;
-
-		/*Condition to prevent the value of units from increasing if it
-		 * reached the maximum value*/
-		if(up_minutesUnits == MAXIMUM_MINUTES_UNITS_UP)
+		if((digit > minimum) && (digit <= maximum))
 		{
-			/*if it reached the maximum value of units return the value to initial value*/
-			up_minutesUnits = INITIAL_VALUE;
+			digit--;
 		}
-		/*Overwrite the new value of the hours on the g_minutes variable*/
-		g_minutes = ( ( MULTIPLY_BY_TEN(TENS(g_minutes))) + up_minutesUnits);
-	}
-	/**************************************************************************
-	 *                     Handle Seconds digit Increasing                    *
-	 **************************************************************************/
-	else if (g_cursorPosition == (SECONDS_TENS_COLUMN + 1))
-	{
-		/*Store the units of the seconds in the variable*/
-		up_secondsTens = TENS(g_seconds);
-
-		/*Increase the stored value by one only as this is one press*/
-		up_secondsTens++;
-
-		/*Condition to prevent the value of tens from increasing if it
-		 * reached the maximum value*/
-		if(up_secondsTens == MAXIMUM_SECONDS_TENS_UP)
+		else if((digit > maximum) || (pgm_read_byte(&descriptor->rule) == FIELD_WRAP))
 		{
-			/*if it reached the maximum value of tens return the value to initial value*/
-			up_secondsTens = INITIAL_VALUE;
+			digit = maximum;
 		}
-
-		/*Overwrite the new value of the hours on the g_seconds variable*/
-		g_seconds = ( (MULTIPLY_BY_TEN(up_secondsTens)) + (UNITS(g_seconds)) );
-
 	}
-	else if(g_cursorPosition == (SECONDS_UNITS_COLUMN + 1))
-	{
-		/*Store the units of the seconds in the variable*/
-		up_secondsUnits = UNITS(g_seconds);
 
-		/*Increase the stored value by one only as this is one press*/
-		up_secondsUnits++;
+	value |= (uint8)(digit << shift);
 
-		/*Condition to prevent the value of units from increasing if it
-		 * reached the maximum value*/
-		if(up_secondsUnits == MAXIMUM_SECONDS_UNITS_UP)
-		{
-			/*if it reached the maximum value of tens return the value to initial value*/
-			up_secondsUnits = INITIAL_VALUE;
-		}
-		/*Overwrite the new value of the hours on the g_seconds variable*/
-		g_seconds = ( ( MULTIPLY_BY_TEN(TENS(g_seconds))) + up_secondsUnits);
+	/*
+	 * A raised tens digit may leave the units above the field maximum (19 --> 29),
+	 * take the field maximum then (23)
+	 */
+	if(value > fieldMaximum)
+	{
+		value = fieldMaximum;
 	}
+
+	(*field) = value;
 }
 /***************************************************************************************************
- * [Function Name]: down_Func
+ * [Function Name]: getCursorColumn
  *
- * [Description]:  Call back function of Timer
+ * [Description]:  Function to read the LCD column of the digit under the cursor
  *
  * [Args]:         NONE
  *
- *
  * [In]            NONE
  *
  * [Out]           NONE
  *
- * [Returns]:      NONE
+ * [Returns]:      LCD column of the selected digit, the first digit if none is selected
  ***************************************************************************************************/
-void down_Func(void)
+uint8 getCursorColumn(void)
 {
-	/*local variable to store the units of the hour variable*/
-	sint8 down_hourUnits     = INITIAL_VALUE;
-
-	/*local variable to store the tens of the hour variable*/
-	sint8 down_hourTens      = INITIAL_VALUE;
-
-	/*local variable to store the units of the minutes variable*/
-	sint8 down_minutesUnits  = INITIAL_VALUE;
-
-	/*local variable to store the tens of the minutes variable*/
-	sint8 down_minutesTens   = INITIAL_VALUE;
-
-	/*local variable to store the units of the seconds variable*/
-	sint8 down_secondsUnits  = INITIAL_VALUE;
-
-	/*local variable to store the tens of the seconds variable*/
-	sint8 down_secondsTens   = INITIAL_VALUE;
-	/**************************************************************************
-	 *                     Handle hours digit decreasing                      *
-	 **************************************************************************/
-	if(g_cursorPosition == (HOUR_TENS_COLUMN + 1))
-	{
-		/*Store the tens of the hours in the variable*/
-		down_hourTens = TENS(g_hours);
-
-		/*decrease the stored value by one only as this is one press*/
-		down_hourTens--;
-
-		/*Condition to prevent the value of tens from decreasing if it
-	     * reached the initial value*/
-		if(down_hourTens <= INITIAL_VALUE)
-		{
-			/*if it reached the initial value of tens, maintain the value to initial value*/
-			down_hourTens = INITIAL_VALUE;
-		}
-
-		/*Overwrite the new value of the hours on the g_hours variable*/
-		g_hours = ( MULTIPLY_BY_TEN(down_hourTens) + UNITS(g_hours) );
-	}
-	else if(g_cursorPosition == (HOUR_UNITS_COLUMN + 1) )
-	{
-		/*Store the units of the hours in the variable*/
-		down_hourUnits = UNITS(g_hours);
-
-		/*decrease the stored value by one only as this is one press*/
-		down_hourUnits--;
-
-		/*Condition to prevent the value of units from decreasing if it
-	     * reached the initial value*/
-		if(down_hourUnits <= INITIAL_VALUE)
-		{
-			/*if it reached the initial value of units, maintain the value to initial value*/
-			down_hourUnits = INITIAL_VALUE;
-		}
-
-		/*Overwrite the new value of the hours on the g_hours variable*/
-		g_hours = (  MULTIPLY_BY_TEN(TENS(g_hours)) + down_hourUnits);
-	}
-	/**************************************************************************
-	 *                     Handle Minutes digit decreasing                     *
-	 **************************************************************************/
-	else if(g_cursorPosition == (MINUTES_TENS_COLUMN + 1))
-	{
-		/*Store the tens of the minutes in the variable*/
-		down_minutesTens = TENS(g_minutes);
-
-		/*decrease the stored value by one only as this is one press*/
-		down_minutesTens--;
-
-		/*Condition to prevent the value of tens from decreasing if it
-	     * reached the initial value*/
-		if(down_minutesTens <= INITIAL_VALUE)
-		{
-			/*if it reached the initial value of tens, maintain the value to initial value*/
-			down_minutesTens = INITIAL_VALUE;
-		}
-
-		/*Overwrite the new value of the minutes on the g_minutes variable*/
-		g_minutes = ( MULTIPLY_BY_TEN(down_minutesTens) + UNITS(g_minutes) );
-	}
-	else if(g_cursorPosition == (MINUTES_UNITS_COLUMN + 1) )
+	if((g_cursorPosition < 0) || (g_cursorPosition >= CLOCK_EDIT_FIELDS))
 	{
-		/*Store the units of the minutes in the variable*/
-		down_minutesUnits = UNITS(g_minutes);
-
-		/*decrease the stored value by one only as this is one press*/
-		down_minutesUnits--;
-
-		/*Condition to prevent the value of units from decreasing if it
-	     * reached the initial value*/
-		if(down_minutesUnits <= INITIAL_VALUE)
-		{
-			/*if it reached the initial value of units, maintain the value to initial value*/
-			down_minutesUnits = INITIAL_VALUE;
-		}
-		/*Overwrite the new value of the minutes on the g_minutes variable*/
-		g_minutes = ( MULTIPLY_BY_TEN(TENS(g_minutes)) + down_minutesUnits);
+		return pgm_read_byte(&g_clockFields[0].column);
 	}
-	/**************************************************************************
-	 *                     Handle Seconds digit decreasing                     *
-	 **************************************************************************/
-	else if (g_cursorPosition == (SECONDS_TENS_COLUMN + 1))
-	{
-		/*Store the tens of the seconds in the variable*/
-		down_secondsTens = TENS(g_seconds);
-
-		/*decrease the stored value by one only as this is one press*/
-		down_secondsTens--;
 
-		/*Condition to prevent the value of tens from decreasing if it
-	     * reached the initial value*/
-		if(down_secondsTens <= INITIAL_VALUE)
-		{
-			/*if it reached the initial value of units, maintain the value to initial value*/
-			down_secondsTens = INITIAL_VALUE;
-		}
-
-		/*Overwrite the new value of the seconds on the g_seconds variable*/
-		g_seconds = ( MULTIPLY_BY_TEN(down_secondsTens) + UNITS(g_seconds) );
-	}
-	else if(g_cursorPosition == (SECONDS_UNITS_COLUMN + 1) )
-	{
-		/*Store the units of the seconds in the variable*/
-		down_secondsUnits = UNITS(g_seconds);
-
-		/*decrease the stored value by one only as this is one press*/
-		down_secondsUnits--;
-
-		/*Condition to prevent the value of units from decreasing if it
-	     * reached the initial value*/
-		if(down_secondsUnits <= INITIAL_VALUE)
-		{
-			/*if it reached the initial value of units, maintain the value to initial value*/
-			down_secondsUnits = INITIAL_VALUE;
-		}
-		/*Overwrite the new value of the seconds on the g_seconds variable*/
-		g_seconds = ( MULTIPLY_BY_TEN(TENS(g_seconds)) + down_secondsUnits);
-	}
+	return pgm_read_byte(&g_clockFields[g_cursorPosition].column);
 }
 /**************************************************************************************/
 
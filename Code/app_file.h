@@ -17,43 +17,138 @@
 #include"timer_interface.h"
 #include"External_Interrupt_interface.h"
 #include"lcd.h"
+#include"soft_timer.h"
+#include"button.h"
+#include"event_queue.h"
+#include"isr_hooks.h"
+#include"app_hooks.h"
 
 /**************************************************************************
  *                          Pre-Processor Macros                          *
  **************************************************************************/
 
-#define TENS(VALUE)                           ((VALUE)/10)
-#define UNITS(VALUE)                          ((VALUE)%10)
-#define MULTIPLY_BY_TEN(VAR)                   ((VAR)*10)
+/*
+ * The time is stored as packed BCD, the tens digit in the high nibble
+ * and the units digit in the low nibble, so no division is needed
+ */
+#define TENS(VALUE)                           ((uint8)((VALUE)>>4))
+#define UNITS(VALUE)                          ((uint8)((VALUE) & 0X0F))
+#define BCD_PACK(TENS_DIGIT, UNITS_DIGIT)     ((uint8)(((TENS_DIGIT)<<4) | (UNITS_DIGIT)))
+#define BCD_DIGIT_LIMIT                       10
+#define BCD_DIGIT_ADJUST                      6
 
 
-#define UP_BUTTON_PORT_REG                    PORTA
-#define UP_BUTTON_DIRECTION_REG               DDRA
-#define UP_BUTTON_INPUT_REG                   PINA
+/*
+ * UP/DOWN buttons on the port of button.h (PORTA), debounced by the button driver
+ */
 #define UP_BUTTON_PIN                         PA0
-
-#define DOWN_BUTTON_PORT_REG                  PORTA
-#define DOWN_BUTTON_DIRECTION_REG             DDRA
-#define DOWN_BUTTON_INPUT_REG                 PINA
 #define DOWN_BUTTON_PIN                       PA1
+#define UP_BUTTON_MASK                        (1<<UP_BUTTON_PIN)
+#define DOWN_BUTTON_MASK                      (1<<DOWN_BUTTON_PIN)
+
+/*
+ * Holding UP/DOWN for BUTTON_LONG_PRESS_MS steps the digit again and starts
+ * the auto-repeat, the repeat starts every BUTTON_REPEAT_INTERVAL_MS and gets
+ * BUTTON_REPEAT_STEP_MS faster every step down to BUTTON_REPEAT_MINIMUM_MS
+ */
+#define BUTTON_LONG_PRESS_MS                  500
+#define BUTTON_REPEAT_INTERVAL_MS             250
+#define BUTTON_REPEAT_MINIMUM_MS              50
+#define BUTTON_REPEAT_STEP_MS                 25
+
+/*
+ * Right/Left/OK buttons on INT0/INT1/INT2, after a press the interrupt is
+ * masked until the button is quiet for BUTTON_LOCKOUT_MS (Timer0 ticks)
+ */
+#define BUTTON_LOCKOUT_MS                     30
+#define BUTTON_LOCKOUT_TICKS                  SOFT_TIMER_MS_TO_TICKS(BUTTON_LOCKOUT_MS)
 
 #define INITIAL_COUNT                           0
 
 #define INITIAL_VALUE                           0
-#define COMPARE_VALUE                           977
-
 
-#define  MAXIMUM_HOURS                         24
-#define  MAXIMUM_SECONDS                       60
-#define  MAXIMUM_MINUTES                       60
+/*
+ * Timer1 generates the 1 second tick of the clock, the period solver picks
+ * the smallest pre-scaler whose count of one second fits 16 bits, /64 at
+ * 1MHz (15625 counts, remainder 0) and /256 at 8 or 16MHz (31250/62500
+ * counts, remainder 0). The remainder is not 0 only when F_CPU is not a
+ * multiple of the pre-scaler (20MHz picks /1024: 19531.25 counts), so the
+ * whole counts and the remainder are given to the fractional compare match
+ * of Timer1 to avoid any long run drift
+ */
+#define CLOCK_TICK_US                           1000000UL
+#define CLOCK_TIMER_CLOCK                       TIMER_CLOCK_US(TIMER1, CLOCK_TICK_US)
+#define CLOCK_TIMER_PRESCALER                   TIMER_PRESCALER_US(TIMER1, CLOCK_TICK_US)
+#define CLOCK_TICK_COUNTS                       (F_CPU / CLOCK_TIMER_PRESCALER)
+#define CLOCK_TICK_REMAINDER                    (F_CPU % CLOCK_TIMER_PRESCALER)
+#define COMPARE_VALUE                           (CLOCK_TICK_COUNTS - 1)
+
+#if (!TIMER_IN_RANGE_US(TIMER1, CLOCK_TICK_US))
+#error "Timer1 can not count one second at this F_CPU"
+#endif
+
+/*
+ * Source of the 1 second tick (CLOCK_TICK_SOURCE) --> isr_hooks_config.h
+ */
+
+/*
+ * Start a new second now, used when the edited time is committed
+ */
+#if (CLOCK_TICK_SOURCE == CLOCK_TICK_SOURCE_RTC)
+#define CLOCK_REALIGN()                         Timer2_RTC_restartPeriod()
+#else
+#define CLOCK_REALIGN()                         Timer1_restartPeriod()
+#endif
+
+/*
+ * Timer0 drives the LCD write queue and the software timers every 1ms,
+ * the build fails if the solved period is off by more than the budget
+ */
+#define SYSTEM_TICK_US                          (SOFT_TIMER_TICK_MS * 1000UL)
+#define SYSTEM_TICK_ERROR_BUDGET_PPM            1000
+#define LCD_TIMER_CLOCK                         TIMER_CLOCK_US(TIMER0, SYSTEM_TICK_US)
+#define LCD_TIMER_COMPARE_VALUE                 TIMER_COMPARE_US(TIMER0, SYSTEM_TICK_US)
+
+#if (!TIMER_IN_RANGE_US(TIMER0, SYSTEM_TICK_US))
+#error "Timer0 can not count the system tick at this F_CPU"
+#elif (TIMER_ERROR_PPM_US(TIMER0, SYSTEM_TICK_US) > SYSTEM_TICK_ERROR_BUDGET_PPM)
+#error "System tick error exceeds SYSTEM_TICK_ERROR_BUDGET_PPM at this F_CPU"
+#endif
+
+/*
+ * The main loop sleeps when it has no work, the CPU wakes up on any
+ * interrupt: the clock tick, INT0/1/2 or the ~1ms Timer0 tick which
+ * drains the LCD queue and samples the UP/DOWN buttons.
+ * Idle mode keeps every timer running. Power-save mode (RTC tick only)
+ * stops Timer0 and Timer1 too, but INT0/INT1 edges need the I/O clock
+ * so Right/Left can not wake the CPU from it, only OK (INT2) and the RTC
+ * can, that is why it must be enabled on purpose
+ */
+#ifndef CLOCK_SLEEP_POWER_SAVE
+#define CLOCK_SLEEP_POWER_SAVE                  FALSE
+#endif
+
+/*
+ * Bits of the change mask returned by DigitalClock
+ */
+#define SECONDS_UNITS_CHANGED                  (1<<0)
+#define SECONDS_TENS_CHANGED                   (1<<1)
+#define MINUTES_UNITS_CHANGED                  (1<<2)
+#define MINUTES_TENS_CHANGED                   (1<<3)
+#define HOURS_UNITS_CHANGED                    (1<<4)
+#define HOURS_TENS_CHANGED                     (1<<5)
+#define NO_DIGIT_CHANGED                       0X00
+#define ALL_DIGITS_CHANGED                     0X3F
+
+#define  MAXIMUM_HOURS                         0X24
+#define  MAXIMUM_SECONDS                       0X60
+#define  MAXIMUM_MINUTES                       0X60
 
 #define DISPLAY_CURSOR_COMMAND                0X0E
 #define DISPLAY_BLINKING_CURSOR_COMMAND       0X0F
 
 #define HIDE_CURSOR_COMMAND                   0x0C
 
-#define DEBOUNCE_TIME                          25
-
 
 #define DIGITAL_CLOCK_ROW                      0
 
@@ -68,25 +163,79 @@
 
 #define SECONDS_TENS_COLUMN                    10
 #define SECONDS_UNITS_COLUMN                   11
-#define END_OF_CLOCK_COLUMN                    12
-#define INITIAL_POSITION                        HOUR_TENS_COLUMN
 
-#define MAXIMUM_HOURS_TENS_UP                   3
-#define MAXIMUM_MINUTES_TENS_UP                 6
-#define MAXIMUM_SECONDS_TENS_UP                 6
+/*
+ * The Set Clock State edits the digits listed in the field table of
+ * app_file.c, the cursor is the index of the digit in the table and
+ * starts before the first digit so the first Right/Left selects it
+ */
+#define CLOCK_EDIT_FIELDS                      6
+#define INITIAL_POSITION                       (-1)
+
+/*
+ * Shift of the digit in its packed BCD field
+ */
+#define TENS_DIGIT_SHIFT                       4
+#define UNITS_DIGIT_SHIFT                      0
+#define BCD_DIGIT_MASK                         0X0F
+
+/*
+ * Rule of a digit stepped past its limits:
+ * FIELD_WRAP     --> maximum + 1 gives the minimum and minimum - 1 the maximum
+ * FIELD_SATURATE --> the digit stops at its limits
+ */
+#define FIELD_WRAP                             0
+#define FIELD_SATURATE                         1
+
+/*
+ * Direction of the digit step
+ */
+#define DIGIT_UP                               1
+#define DIGIT_DOWN                             (-1)
 
-#define MAXIMUM_HOURS_UNITS_UP                  5
-#define MAXIMUM_MINUTES_UNITS_UP                10
-#define MAXIMUM_SECONDS_UNITS_UP                10
+/**************************************************************************
+ *                          Types Declaration                             *
+ **************************************************************************/
+/*
+ * Packed BCD time of the clock
+ */
+typedef struct
+{
+	uint8 hours;
+	uint8 minutes;
+	uint8 seconds;
+}Clock_TimeType;
+
+/*
+ * Descriptor of one editable digit, the field table is kept in flash:
+ * column       --> LCD column of the digit
+ * field        --> offset of its packed BCD field in Clock_TimeType
+ * shift        --> weight of the digit in the field (TENS/UNITS_DIGIT_SHIFT)
+ * minimum      --> smallest value of the digit
+ * maximum      --> largest value of the digit
+ * fieldMaximum --> largest packed BCD value of the whole field, it limits the
+ *                  units under the top tens (hours 20-23) and a raised tens
+ * rule         --> FIELD_WRAP or FIELD_SATURATE
+ */
+typedef struct
+{
+	uint8 column;
+	uint8 field;
+	uint8 shift;
+	uint8 minimum;
+	uint8 maximum;
+	uint8 fieldMaximum;
+	uint8 rule;
+}Clock_FieldType;
 
 /**************************************************************************
  *                     Extern Variables                     *
  **************************************************************************/
 
-extern uint8 g_seconds;
-extern uint8 g_minutes;
-extern uint8 g_hours;
-extern uint8 g_tick;
+/*time of the clock, counted by the main loop in both states*/
+extern Clock_TimeType g_time;
+/*copy of the time changed by the UP/DOWN buttons in the Set Clock State*/
+extern Clock_TimeType g_editTime;
 extern sint8 g_cursorPosition;
 extern uint8 g_OK;
 
@@ -94,21 +243,39 @@ extern uint8 g_OK;
  *                           Functions Prototypes                         *
  **************************************************************************/
 
-void down_Func(void);
+void stepDigit(sint8 a_direction);
+
+uint8 getCursorColumn(void);
 
-void UP_Func(void);
+void display(const Clock_TimeType *time, uint8 changeMask);
 
-void display(void);
+void commitEditTime(void);
 
-void DigitalClock(void);
+uint8 DigitalClock(void);
 
 void tick(void);
 
+uint16 getLostTicks(void);
+
+void systemTick(void);
+
+void sleepUntilInterrupt(uint8 pendingDigits);
+
+uint16 getDutyCycle(void);
+
 void Right(void);
 
 void Left(void);
 
-void OK_FUNC(void);
+uint8 OK_FUNC(void);
+
+uint8 handleEvent(Event_Type a_event);
+
+void postRight(void);
+
+void postLeft(void);
+
+void postOK(void);
 
 
 
@@ -0,0 +1,90 @@
+/**********************************************************************************
+ * [FILE NAME]: app_hooks.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: Application side of the ISR hooks of the Digital Clock, the
+ *                work of the hooks expanded in the ISRs and the application
+ *                variables they use. Only isr_hooks_config.h (with ISR_HOOKS
+ *                TRUE) and the application include it, so the drivers need
+ *                no application symbol when no hook is bound
+ *
+ ***********************************************************************************/
+#ifndef APP_HOOKS_H_
+#define APP_HOOKS_H_
+
+#include "std_types.h"
+#include "lcd.h"
+#include "soft_timer.h"
+#include "External_Interrupt_interface.h"
+#include "event_queue.h"
+
+/**************************************************************************
+ *                          Preprocessor Macros                           *
+ * ************************************************************************/
+#define MAXIMUM_PENDING_TICKS                   255
+
+/*
+ * Number of Timer0 ticks of one duty cycle measurement window
+ */
+#define DUTY_CYCLE_WINDOW                       1000
+
+/*
+ * Count the clock interrupt as a pending second, if the main loop is so
+ * late that the counter is full the second is lost and counted,
+ * a macro so it is expanded in the ISR and needs no call
+ */
+#define CLOCK_TICK_HOOK() \
+	do \
+	{ \
+		if((uint8)(g_tickCount - g_processedTicks) < MAXIMUM_PENDING_TICKS) \
+		{ \
+			g_tickCount++; \
+		} \
+		else \
+		{ \
+			g_lostTicks++; \
+		} \
+	}while(0)
+
+/*
+ * Work of the 1ms system tick: sends the next queued LCD byte, advances the
+ * software timers, ends the lock out of the Right/Left/OK interrupts and
+ * samples whether the CPU was awake (g_cpuAwake is cleared just before
+ * sleeping, so the tick which wakes the CPU up is counted as a sleeping tick),
+ * a macro so the duty cycle sampling is expanded in the Timer0 ISR and only
+ * the three services are called
+ */
+#define SYSTEM_TICK_HOOK() \
+	do \
+	{ \
+		LCD_serviceQueue(); \
+		SoftTimer_tick(); \
+		INT_lockoutTick(); \
+		if(g_cpuAwake == TRUE) \
+		{ \
+			g_awakeSamples++; \
+		} \
+		g_dutyCycleSamples++; \
+		if(g_dutyCycleSamples == DUTY_CYCLE_WINDOW) \
+		{ \
+			g_lastDutyCycle = g_awakeSamples; \
+			g_awakeSamples = 0; \
+			g_dutyCycleSamples = 0; \
+		} \
+	}while(0)
+
+/**************************************************************************
+ *                          Extern Variables                              *
+ * ************************************************************************/
+extern volatile uint8 g_tickCount;
+extern volatile uint8 g_processedTicks;
+extern volatile uint16 g_lostTicks;
+extern volatile bool g_cpuAwake;
+extern volatile uint16 g_awakeSamples;
+extern volatile uint16 g_dutyCycleSamples;
+extern volatile uint16 g_lastDutyCycle;
+
+#endif /* APP_HOOKS_H_ */
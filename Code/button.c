@@ -0,0 +1,379 @@
+/**********************************************************************************
+ * [FILE NAME]: button.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: File of the push buttons debouncing, the port is sampled from a
+ *                periodic software timer and every pin is filtered by an integrator
+ ***********************************************************************************/
+#include"button.h"
+
+static SoftTimer_Type g_Button_sampleTimer;
+static uint8 g_Button_pinMask = 0;
+static uint8 g_Button_integrator[BUTTON_PINS];
+
+/*
+ * Debounced state and the edges not taken by the main loop yet,
+ * one bit per pin, written by Button_sample only
+ */
+static volatile uint8 g_Button_state = 0;
+static volatile uint8 g_Button_pressed = 0;
+static volatile uint8 g_Button_released = 0;
+/*
+ * Time stamp of the buttons in milli seconds, written by Button_sample only
+ */
+static volatile uint16 g_Button_millis = 0;
+
+/*
+ * Gesture engine state, used by the main loop only
+ */
+static Button_GestureConfigType g_Button_gestureConfig;
+static uint8 g_Button_gestureMask = 0;
+/*buttons held which did not reach the long press yet*/
+static uint8 g_Button_waitingLong = 0;
+/*buttons held after their long press, repeating*/
+static uint8 g_Button_repeating = 0;
+/*time of the next long press or repeat and the current repeat interval of every pin*/
+static uint16 g_Button_deadline[BUTTON_PINS];
+static uint16 g_Button_repeatInterval[BUTTON_PINS];
+
+/***************************************************************************************************
+ * [Function Name]: Button_init
+ *
+ * [Description]:  Function to configure the button pins as inputs with pull up and start
+ *                 sampling them, SoftTimer_init must be called before
+ *
+ * [Args]:         a_pinMask
+ *
+ * [In]            a_pinMask: Mask of the pins of BUTTON_INPUT_REG which are buttons
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Button_init(uint8 a_pinMask)
+{
+	uint8 pin;
+
+	/*
+	 * Input pins with the internal pull up
+	 */
+	BUTTON_DIRECTION_REG &= (uint8)(~a_pinMask);
+	BUTTON_PORT_REG |= a_pinMask;
+
+	for(pin = 0; pin < BUTTON_PINS; pin++)
+	{
+		g_Button_integrator[pin] = 0;
+	}
+	g_Button_pinMask = a_pinMask;
+	g_Button_state = 0;
+	g_Button_pressed = 0;
+	g_Button_released = 0;
+	g_Button_millis = 0;
+	g_Button_gestureMask = 0;
+	g_Button_waitingLong = 0;
+	g_Button_repeating = 0;
+
+	SoftTimer_create(&g_Button_sampleTimer, Button_sample, SoftTimer_ISR);
+	SoftTimer_start(&g_Button_sampleTimer, SOFT_TIMER_MS_TO_TICKS(BUTTON_SAMPLE_MS),
+			SOFT_TIMER_MS_TO_TICKS(BUTTON_SAMPLE_MS));
+}
+/***************************************************************************************************
+ * [Function Name]: Button_sample
+ *
+ * [Description]:  Function to read the port once and update the integrator of every button,
+ *                 call back of the sampling software timer (interrupt context)
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Button_sample(void)
+{
+	/*
+	 * One read of the port for all the buttons, a pressed button reads 0
+	 */
+	uint8 raw = (uint8)(~BUTTON_INPUT_REG) & g_Button_pinMask;
+	uint8 state = g_Button_state;
+	uint8 pin;
+	uint8 bit;
+
+	for(pin = 0, bit = 1; pin < BUTTON_PINS; pin++, bit <<= 1)
+	{
+		if((g_Button_pinMask & bit) == 0)
+		{
+			continue;
+		}
+
+		if(raw & bit)
+		{
+			if(g_Button_integrator[pin] < BUTTON_INTEGRATOR_MAXIMUM)
+			{
+				g_Button_integrator[pin]++;
+			}
+		}
+		else if(g_Button_integrator[pin] > 0)
+		{
+			g_Button_integrator[pin]--;
+		}
+
+		/*
+		 * Change the state at the limits only, between them the last state is kept
+		 */
+		if((g_Button_integrator[pin] == BUTTON_INTEGRATOR_MAXIMUM) && ((state & bit) == 0))
+		{
+			state |= bit;
+			g_Button_pressed |= bit;
+		}
+		else if((g_Button_integrator[pin] == 0) && (state & bit))
+		{
+			state &= (uint8)(~bit);
+			g_Button_released |= bit;
+		}
+	}
+
+	g_Button_state = state;
+	g_Button_millis += BUTTON_SAMPLE_MS;
+}
+/***************************************************************************************************
+ * [Function Name]: Button_getPressed
+ *
+ * [Description]:  Function to take the buttons pressed since the last call, each press
+ *                 is returned once
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Mask of the pins pressed since the last call
+ ***************************************************************************************************/
+uint8 Button_getPressed(void)
+{
+	uint8 pressed;
+	uint8 sreg = SREG;
+
+	/*
+	 * Read and clear as one step, the sample may add a press in between
+	 */
+	cli();
+	pressed = g_Button_pressed;
+	g_Button_pressed = 0;
+	SREG = sreg;
+
+	return pressed;
+}
+/***************************************************************************************************
+ * [Function Name]: Button_getReleased
+ *
+ * [Description]:  Function to take the buttons released since the last call, each release
+ *                 is returned once
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Mask of the pins released since the last call
+ ***************************************************************************************************/
+uint8 Button_getReleased(void)
+{
+	uint8 released;
+	uint8 sreg = SREG;
+
+	cli();
+	released = g_Button_released;
+	g_Button_released = 0;
+	SREG = sreg;
+
+	return released;
+}
+/***************************************************************************************************
+ * [Function Name]: Button_getState
+ *
+ * [Description]:  Function to read the debounced state of the buttons
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Mask of the pins held down now
+ ***************************************************************************************************/
+uint8 Button_getState(void)
+{
+	return g_Button_state;
+}
+/***************************************************************************************************
+ * [Function Name]: Button_isEventPending
+ *
+ * [Description]:  Function to know if a press or a release waits for the main loop
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TRUE if a press or a release was not taken yet
+ ***************************************************************************************************/
+bool Button_isEventPending(void)
+{
+	return ((g_Button_pressed | g_Button_released) != 0) ? TRUE : FALSE;
+}
+/***************************************************************************************************
+ * [Function Name]: Button_getMillis
+ *
+ * [Description]:  Function to read the time stamp of the buttons, advanced by BUTTON_SAMPLE_MS
+ *                 every sample
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Free running milli seconds, wraps every ~65 seconds
+ ***************************************************************************************************/
+uint16 Button_getMillis(void)
+{
+	uint16 millis;
+	uint8 sreg = SREG;
+
+	/*
+	 * 16-bit variable written by the interrupt, read it with the interrupts disabled
+	 */
+	cli();
+	millis = g_Button_millis;
+	SREG = sreg;
+
+	return millis;
+}
+/***************************************************************************************************
+ * [Function Name]: Button_setGestureConfig
+ *
+ * [Description]:  Function to choose the buttons which report long presses and repeats
+ *                 and the timing of their gestures, the configuration is copied
+ *
+ * [Args]:         a_pinMask, a_config_PTR
+ *
+ * [In]            a_pinMask: Mask of the buttons with long press and repeat
+ *                 a_config_PTR: Pointer to the timing of the gestures
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Button_setGestureConfig(uint8 a_pinMask, const Button_GestureConfigType *a_config_PTR)
+{
+	g_Button_gestureConfig = *a_config_PTR;
+
+	/*
+	 * A repeat can not be faster than the buttons are sampled
+	 */
+	if(g_Button_gestureConfig.repeatMinimumMs < BUTTON_SAMPLE_MS)
+	{
+		g_Button_gestureConfig.repeatMinimumMs = BUTTON_SAMPLE_MS;
+	}
+	if(g_Button_gestureConfig.repeatIntervalMs < g_Button_gestureConfig.repeatMinimumMs)
+	{
+		g_Button_gestureConfig.repeatIntervalMs = g_Button_gestureConfig.repeatMinimumMs;
+	}
+
+	g_Button_gestureMask = a_pinMask & g_Button_pinMask;
+	g_Button_waitingLong = 0;
+	g_Button_repeating = 0;
+}
+/***************************************************************************************************
+ * [Function Name]: Button_getGestures
+ *
+ * [Description]:  Function to take the presses and releases of the buttons and find their
+ *                 gestures against the time stamp, it never waits so it is called every pass
+ *                 of the main loop, a repeat missed by a slow pass is given once not repeated
+ *
+ * [Args]:         a_gestures_PTR
+ *
+ * [In]            NONE
+ *
+ * [Out]           a_gestures_PTR: Masks of the buttons of every gesture
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Button_getGestures(Button_GestureType *a_gestures_PTR)
+{
+	uint16 now = Button_getMillis();
+	uint8 pressed = Button_getPressed();
+	uint8 released = Button_getReleased();
+	uint8 pin;
+	uint8 bit;
+
+	a_gestures_PTR->pressed = pressed;
+	a_gestures_PTR->shortPress = 0;
+	a_gestures_PTR->longPress = 0;
+	a_gestures_PTR->repeat = 0;
+
+	/*
+	 * A release ends the gesture, before the long press it was a short press.
+	 * A press and a release taken together (a tap shorter than one pass of the
+	 * main loop) are a short press too
+	 */
+	a_gestures_PTR->shortPress = released & (uint8)(g_Button_waitingLong | pressed);
+	g_Button_waitingLong &= (uint8)(~released);
+	g_Button_repeating &= (uint8)(~released);
+
+	for(pin = 0, bit = 1; pin < BUTTON_PINS; pin++, bit <<= 1)
+	{
+		if((g_Button_gestureMask & bit) == 0)
+		{
+			/*
+			 * Buttons without long press end every press with a short press
+			 */
+			a_gestures_PTR->shortPress |= (uint8)(released & bit);
+			continue;
+		}
+
+		/*
+		 * A new press which is still held starts waiting for the long press
+		 */
+		if((pressed & bit) && ((released & bit) == 0))
+		{
+			g_Button_waitingLong |= bit;
+			g_Button_deadline[pin] = now + g_Button_gestureConfig.longPressMs;
+		}
+		else if((g_Button_waitingLong & bit) && BUTTON_TIME_REACHED(now, g_Button_deadline[pin]))
+		{
+			a_gestures_PTR->longPress |= bit;
+			g_Button_waitingLong &= (uint8)(~bit);
+			g_Button_repeating |= bit;
+			g_Button_repeatInterval[pin] = g_Button_gestureConfig.repeatIntervalMs;
+			g_Button_deadline[pin] = now + g_Button_repeatInterval[pin];
+		}
+		else if((g_Button_repeating & bit) && BUTTON_TIME_REACHED(now, g_Button_deadline[pin]))
+		{
+			a_gestures_PTR->repeat |= bit;
+			/*
+			 * Accelerate: shorten the interval down to the minimum, the next
+			 * repeat is timed from now so a late pass does not give a burst
+			 */
+			if(g_Button_repeatInterval[pin] >=
+					(uint16)(g_Button_gestureConfig.repeatMinimumMs + g_Button_gestureConfig.repeatStepMs))
+			{
+				g_Button_repeatInterval[pin] -= g_Button_gestureConfig.repeatStepMs;
+			}
+			else
+			{
+				g_Button_repeatInterval[pin] = g_Button_gestureConfig.repeatMinimumMs;
+			}
+			g_Button_deadline[pin] = now + g_Button_repeatInterval[pin];
+		}
+	}
+}
@@ -0,0 +1,222 @@
+/**********************************************************************************
+ * [FILE NAME]: button.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                debounced push buttons polled on one port.
+ *
+ ***********************************************************************************/
+#ifndef BUTTON_H_
+#define BUTTON_H_
+
+#include "std_types.h"
+#include "common_macros.h"
+#include "micro_config.h"
+#include "soft_timer.h"
+
+/**************************************************************************
+ *                          Preprocessor Macros                           *
+ * ************************************************************************/
+/*
+ * Port of the buttons, a button connects its pin to ground
+ * and the internal pull up keeps it high when released
+ */
+#define BUTTON_PORT_REG                             PORTA
+#define BUTTON_DIRECTION_REG                        DDRA
+#define BUTTON_INPUT_REG                            PINA
+#define BUTTON_PINS                                 8
+
+/*
+ * The port is sampled every BUTTON_SAMPLE_MS by a software timer, every
+ * pin has an integrator counting up while the pin reads pressed and down
+ * while it reads released, the debounced state changes only when the
+ * integrator reaches 0 or BUTTON_INTEGRATOR_MAXIMUM, so a bounce has to
+ * last BUTTON_SAMPLE_MS * BUTTON_INTEGRATOR_MAXIMUM (25ms) to be seen
+ */
+#define BUTTON_SAMPLE_MS                            5
+#define BUTTON_INTEGRATOR_MAXIMUM                   5
+
+/*
+ * Time of the gestures is taken from the sampling timer, a free running
+ * 16-bit count of milli seconds, so two readings are compared by their
+ * difference and a duration must be shorter than ~32 seconds
+ */
+#define BUTTON_TIME_REACHED(NOW, DEADLINE)          ((sint16)((uint16)((NOW) - (DEADLINE))) >= 0)
+
+/**************************************************************************
+ *                          Types Declaration                             *
+ * ************************************************************************/
+/*
+ * Timing of the gestures, all in milli seconds:
+ * longPressMs       --> hold time after which the press is a long press
+ * repeatIntervalMs  --> time between the long press and the first repeat
+ * repeatMinimumMs   --> shortest time between two repeats
+ * repeatStepMs      --> the time to the next repeat is shortened by it after
+ *                       every repeat, so the repeat gets faster while held
+ */
+typedef struct
+{
+	uint16 longPressMs;
+	uint16 repeatIntervalMs;
+	uint16 repeatMinimumMs;
+	uint16 repeatStepMs;
+}Button_GestureConfigType;
+
+/*
+ * Gestures found by one call of Button_getGestures, one bit per pin:
+ * pressed    --> the button went down
+ * shortPress --> the button was released before longPressMs
+ * longPress  --> the button is held for longPressMs (once per press)
+ * repeat     --> the button is still held after the long press
+ */
+typedef struct
+{
+	uint8 pressed;
+	uint8 shortPress;
+	uint8 longPress;
+	uint8 repeat;
+}Button_GestureType;
+
+/**************************************************************************
+ *                          Functions Prototypes                          *
+ * ************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: Button_init
+ *
+ * [Description]:  Function to configure the button pins as inputs with pull up and start
+ *                 sampling them, SoftTimer_init must be called before
+ *
+ * [Args]:         a_pinMask
+ *
+ * [In]            a_pinMask: Mask of the pins of BUTTON_INPUT_REG which are buttons
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Button_init(uint8 a_pinMask);
+/***************************************************************************************************
+ * [Function Name]: Button_sample
+ *
+ * [Description]:  Function to read the port once and update the integrator of every button,
+ *                 call back of the sampling software timer (interrupt context)
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Button_sample(void);
+/***************************************************************************************************
+ * [Function Name]: Button_getPressed
+ *
+ * [Description]:  Function to take the buttons pressed since the last call, each press
+ *                 is returned once
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Mask of the pins pressed since the last call
+ ***************************************************************************************************/
+uint8 Button_getPressed(void);
+/***************************************************************************************************
+ * [Function Name]: Button_getReleased
+ *
+ * [Description]:  Function to take the buttons released since the last call, each release
+ *                 is returned once
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Mask of the pins released since the last call
+ ***************************************************************************************************/
+uint8 Button_getReleased(void);
+/***************************************************************************************************
+ * [Function Name]: Button_getState
+ *
+ * [Description]:  Function to read the debounced state of the buttons
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Mask of the pins held down now
+ ***************************************************************************************************/
+uint8 Button_getState(void);
+/***************************************************************************************************
+ * [Function Name]: Button_isEventPending
+ *
+ * [Description]:  Function to know if a press or a release waits for the main loop
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TRUE if a press or a release was not taken yet
+ ***************************************************************************************************/
+bool Button_isEventPending(void);
+/***************************************************************************************************
+ * [Function Name]: Button_getMillis
+ *
+ * [Description]:  Function to read the time stamp of the buttons, advanced by BUTTON_SAMPLE_MS
+ *                 every sample
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Free running milli seconds, wraps every ~65 seconds
+ ***************************************************************************************************/
+uint16 Button_getMillis(void);
+/***************************************************************************************************
+ * [Function Name]: Button_setGestureConfig
+ *
+ * [Description]:  Function to choose the buttons which report long presses and repeats
+ *                 and the timing of their gestures, the configuration is copied
+ *
+ * [Args]:         a_pinMask, a_config_PTR
+ *
+ * [In]            a_pinMask: Mask of the buttons with long press and repeat
+ *                 a_config_PTR: Pointer to the timing of the gestures
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Button_setGestureConfig(uint8 a_pinMask, const Button_GestureConfigType *a_config_PTR);
+/***************************************************************************************************
+ * [Function Name]: Button_getGestures
+ *
+ * [Description]:  Function to take the presses and releases of the buttons and find their
+ *                 gestures against the time stamp, it never waits so it is called every pass
+ *                 of the main loop, a repeat missed by a slow pass is given once not repeated
+ *
+ * [Args]:         a_gestures_PTR
+ *
+ * [In]            NONE
+ *
+ * [Out]           a_gestures_PTR: Masks of the buttons of every gesture
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Button_getGestures(Button_GestureType *a_gestures_PTR);
+
+#endif /* BUTTON_H_ */
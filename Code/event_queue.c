@@ -0,0 +1,104 @@
+/**********************************************************************************
+ * [FILE NAME]: event_queue.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: File of the single producer / single consumer event queue, the
+ *                interrupts post the events and the main loop handles them
+ ***********************************************************************************/
+#include"event_queue.h"
+
+/*
+ * The indexes run freely, head - tail is the number of the queued events
+ */
+volatile uint8 g_eventQueue[EVENT_QUEUE_SIZE];
+volatile uint8 g_eventQueueHead = 0;
+volatile uint8 g_eventQueueTail = 0;
+volatile uint8 g_eventQueueDropped = 0;
+
+/***************************************************************************************************
+ * [Function Name]: EventQueue_post
+ *
+ * [Description]:  Function to add an event at the head of the queue, called by the producer
+ *                 (interrupt context) only
+ *
+ * [Args]:         a_event
+ *
+ * [In]            a_event: Event to post
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void EventQueue_post(Event_Type a_event)
+{
+	EVENT_QUEUE_POST(a_event);
+}
+/***************************************************************************************************
+ * [Function Name]: EventQueue_get
+ *
+ * [Description]:  Function to take the oldest event of the queue, called by the consumer
+ *                 (main loop) only
+ *
+ * [Args]:         a_event_PTR
+ *
+ * [In]            NONE
+ *
+ * [Out]           a_event_PTR: The oldest event
+ *
+ * [Returns]:      FALSE if the queue is empty
+ ***************************************************************************************************/
+bool EventQueue_get(Event_Type *a_event_PTR)
+{
+	uint8 tail = g_eventQueueTail;
+
+	if(tail == g_eventQueueHead)
+	{
+		return FALSE;
+	}
+
+	/*
+	 * Read the event before the slot is given back to the producer
+	 */
+	*a_event_PTR = (Event_Type)g_eventQueue[tail & EVENT_QUEUE_MASK];
+	g_eventQueueTail = (uint8)(tail + 1);
+
+	return TRUE;
+}
+/***************************************************************************************************
+ * [Function Name]: EventQueue_isEmpty
+ *
+ * [Description]:  Function to know if the queue has no event
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TRUE if the queue is empty
+ ***************************************************************************************************/
+bool EventQueue_isEmpty(void)
+{
+	return (g_eventQueueHead == g_eventQueueTail) ? TRUE : FALSE;
+}
+/***************************************************************************************************
+ * [Function Name]: EventQueue_getDropped
+ *
+ * [Description]:  Function to read the number of events dropped because the queue was full,
+ *                 for diagnostics
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Number of the dropped events (wraps at 255)
+ ***************************************************************************************************/
+uint8 EventQueue_getDropped(void)
+{
+	return g_eventQueueDropped;
+}
@@ -0,0 +1,132 @@
+/**********************************************************************************
+ * [FILE NAME]: event_queue.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                lock free event queue from the interrupts to the main loop.
+ *
+ ***********************************************************************************/
+#ifndef EVENT_QUEUE_H_
+#define EVENT_QUEUE_H_
+
+#include "std_types.h"
+
+/**************************************************************************
+ *                          Preprocessor Macros                           *
+ * ************************************************************************/
+/*
+ * Ring buffer of a power of two size so the free running 8-bit indexes
+ * wrap with a mask, one slot at least for every source of events
+ */
+#define EVENT_QUEUE_SIZE_SHIFT                      3
+#define EVENT_QUEUE_SIZE                            (1 << EVENT_QUEUE_SIZE_SHIFT)
+#define EVENT_QUEUE_MASK                            (EVENT_QUEUE_SIZE - 1)
+
+/*
+ * Post an event from an ISR, a macro so it is expanded in the ISR.
+ * Single producer: the interrupts do not nest so all the ISRs together
+ * are one producer, only the producer writes the head and only the
+ * consumer (main loop) writes the tail, both are 8-bit so every access
+ * is atomic and no interrupt has to be disabled. The event is stored
+ * before the head is moved so the consumer never reads an empty slot
+ */
+#define EVENT_QUEUE_POST(EVENT) \
+	do \
+	{ \
+		if((uint8)(g_eventQueueHead - g_eventQueueTail) < EVENT_QUEUE_SIZE) \
+		{ \
+			g_eventQueue[g_eventQueueHead & EVENT_QUEUE_MASK] = (EVENT); \
+			g_eventQueueHead++; \
+		} \
+		else \
+		{ \
+			g_eventQueueDropped++; \
+		} \
+	}while(0)
+
+/**************************************************************************
+ *                          Types Declaration                             *
+ * ************************************************************************/
+typedef enum
+{
+	EVENT_RIGHT, EVENT_LEFT, EVENT_OK, EVENT_UP, EVENT_DOWN
+}Event_Type;
+
+/**************************************************************************
+ *                          Extern Variables                              *
+ * ************************************************************************/
+/*
+ * Used by EVENT_QUEUE_POST only, the rest of the code goes through the functions
+ */
+extern volatile uint8 g_eventQueue[EVENT_QUEUE_SIZE];
+extern volatile uint8 g_eventQueueHead;
+extern volatile uint8 g_eventQueueTail;
+extern volatile uint8 g_eventQueueDropped;
+
+/**************************************************************************
+ *                          Functions Prototypes                          *
+ * ************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: EventQueue_post
+ *
+ * [Description]:  Function to add an event at the head of the queue, called by the producer
+ *                 (interrupt context) only
+ *
+ * [Args]:         a_event
+ *
+ * [In]            a_event: Event to post
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void EventQueue_post(Event_Type a_event);
+/***************************************************************************************************
+ * [Function Name]: EventQueue_get
+ *
+ * [Description]:  Function to take the oldest event of the queue, called by the consumer
+ *                 (main loop) only
+ *
+ * [Args]:         a_event_PTR
+ *
+ * [In]            NONE
+ *
+ * [Out]           a_event_PTR: The oldest event
+ *
+ * [Returns]:      FALSE if the queue is empty
+ ***************************************************************************************************/
+bool EventQueue_get(Event_Type *a_event_PTR);
+/***************************************************************************************************
+ * [Function Name]: EventQueue_isEmpty
+ *
+ * [Description]:  Function to know if the queue has no event
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TRUE if the queue is empty
+ ***************************************************************************************************/
+bool EventQueue_isEmpty(void);
+/***************************************************************************************************
+ * [Function Name]: EventQueue_getDropped
+ *
+ * [Description]:  Function to read the number of events dropped because the queue was full,
+ *                 for diagnostics
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Number of the dropped events (wraps at 255)
+ ***************************************************************************************************/
+uint8 EventQueue_getDropped(void);
+
+#endif /* EVENT_QUEUE_H_ */
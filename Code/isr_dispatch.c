@@ -0,0 +1,214 @@
+/**********************************************************************************
+ * [FILE NAME]: isr_dispatch.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: File of the subscriber lists of the interrupt vectors, fixed size
+ *                tables with a context pointer per handler and no dynamic memory
+ ***********************************************************************************/
+#include"isr_dispatch.h"
+#include"micro_config.h"
+
+/***************************************************************************************************
+ * [Function Name]: IsrDispatch_subscribe
+ *
+ * [Description]:  Function to add a handler to the list of a vector, subscribing the same
+ *                 handler & context again does nothing
+ *
+ * [Args]:         a_list, a_handler, a_context
+ *
+ * [In]            a_list:    Pointer to the list of the vector
+ *                 a_handler: Function called from the ISR with a_context
+ *                 a_context: Pointer passed back to the handler, may be NULL_PTR
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the list is full
+ ***************************************************************************************************/
+bool IsrDispatch_subscribe(IsrDispatch_ListType *a_list, void (*a_handler)(void *a_context), void *a_context)
+{
+	uint8 i;
+	uint8 sreg = SREG;
+	bool added = TRUE;
+
+	if(a_handler == NULL_PTR)
+	{
+		return FALSE;
+	}
+
+	cli();
+	for(i = 0; i < a_list->count; i++)
+	{
+		if((a_list->subscriber[i].handler == a_handler) && (a_list->subscriber[i].context == a_context))
+		{
+			break;
+		}
+	}
+
+	if(i == a_list->count)
+	{
+		if(a_list->count < ISR_DISPATCH_MAX_SUBSCRIBERS)
+		{
+			/*
+			 * Fill the entry before it is counted, the ISR never sees a half written one
+			 */
+			a_list->subscriber[i].handler = a_handler;
+			a_list->subscriber[i].callBack = NULL_PTR;
+			a_list->subscriber[i].context = a_context;
+			a_list->count++;
+		}
+		else
+		{
+			added = FALSE;
+		}
+	}
+	SREG = sreg;
+
+	return added;
+}
+/***************************************************************************************************
+ * [Function Name]: IsrDispatch_unsubscribe
+ *
+ * [Description]:  Function to remove a handler & context pair from the list of a vector
+ *
+ * [Args]:         a_list, a_handler, a_context
+ *
+ * [In]            a_list:    Pointer to the list of the vector
+ *                 a_handler: Function given to IsrDispatch_subscribe
+ *                 a_context: Context given to IsrDispatch_subscribe
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void IsrDispatch_unsubscribe(IsrDispatch_ListType *a_list, void (*a_handler)(void *a_context), void *a_context)
+{
+	uint8 i;
+	uint8 sreg = SREG;
+
+	cli();
+	for(i = 0; i < a_list->count; i++)
+	{
+		if((a_list->subscriber[i].handler == a_handler) && (a_list->subscriber[i].context == a_context))
+		{
+			/*
+			 * Shift the next subscribers down to keep the calling order
+			 */
+			a_list->count--;
+			for(; i < a_list->count; i++)
+			{
+				a_list->subscriber[i] = a_list->subscriber[i + 1];
+			}
+			break;
+		}
+	}
+	SREG = sreg;
+}
+/***************************************************************************************************
+ * [Function Name]: IsrDispatch_run
+ *
+ * [Description]:  Function to call all the subscribers of a list, called from the ISR
+ *                 through ISR_DISPATCH_RUN
+ *
+ * [Args]:         a_list
+ *
+ * [In]            a_list: Pointer to the list of the vector
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void IsrDispatch_run(const IsrDispatch_ListType *a_list)
+{
+	uint8 i;
+
+	for(i = 0; i < a_list->count; i++)
+	{
+		if(a_list->subscriber[i].handler != NULL_PTR)
+		{
+			(*a_list->subscriber[i].handler)(a_list->subscriber[i].context);
+		}
+		else
+		{
+			(*a_list->subscriber[i].callBack)();
+		}
+	}
+}
+/***************************************************************************************************
+ * [Function Name]: IsrDispatch_setCallBack
+ *
+ * [Description]:  Function to keep the old Xxx_setCallBack(void(*)(void)) drivers API on top of
+ *                 the lists, the call back replaces the one set before in the list and is
+ *                 called directly by the ISR, NULL_PTR removes it
+ *
+ * [Args]:         a_list, a_ptr
+ *
+ * [In]            a_list: Pointer to the list of the vector
+ *                 a_ptr:  Call back function of the application
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the list is full
+ ***************************************************************************************************/
+bool IsrDispatch_setCallBack(IsrDispatch_ListType *a_list, void (*a_ptr)(void))
+{
+	uint8 i;
+	uint8 sreg = SREG;
+	bool added = TRUE;
+
+	cli();
+	/*
+	 * The call back of the old API is the subscriber without a handler
+	 */
+	for(i = 0; i < a_list->count; i++)
+	{
+		if(a_list->subscriber[i].handler == NULL_PTR)
+		{
+			break;
+		}
+	}
+
+	if(i < a_list->count)
+	{
+		if(a_ptr != NULL_PTR)
+		{
+			/*
+			 * One pointer write, the ISR calls either the old or the new call back
+			 */
+			a_list->subscriber[i].callBack = a_ptr;
+		}
+		else
+		{
+			/*
+			 * Shift the next subscribers down to keep the calling order
+			 */
+			a_list->count--;
+			for(; i < a_list->count; i++)
+			{
+				a_list->subscriber[i] = a_list->subscriber[i + 1];
+			}
+		}
+	}
+	else if(a_ptr != NULL_PTR)
+	{
+		if(a_list->count < ISR_DISPATCH_MAX_SUBSCRIBERS)
+		{
+			/*
+			 * Fill the entry before it is counted, the ISR never sees a half written one
+			 */
+			a_list->subscriber[i].handler = NULL_PTR;
+			a_list->subscriber[i].callBack = a_ptr;
+			a_list->subscriber[i].context = NULL_PTR;
+			a_list->count++;
+		}
+		else
+		{
+			added = FALSE;
+		}
+	}
+	SREG = sreg;
+
+	return added;
+}
@@ -0,0 +1,152 @@
+/**********************************************************************************
+ * [FILE NAME]: isr_dispatch.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                subscriber lists which the timer and external interrupt drivers
+ *                use to call more than one handler from one interrupt vector.
+ *
+ ***********************************************************************************/
+#ifndef ISR_DISPATCH_H_
+#define ISR_DISPATCH_H_
+
+#include "std_types.h"
+
+/**************************************************************************
+ *                          Preprocessor Macros                           *
+ * ************************************************************************/
+/*
+ * Subscribers of one vector, the lists are static tables so every vector
+ * costs ISR_DISPATCH_MAX_SUBSCRIBERS * 6 + 1 bytes of RAM
+ */
+#ifndef ISR_DISPATCH_MAX_SUBSCRIBERS
+#define ISR_DISPATCH_MAX_SUBSCRIBERS                2
+#endif
+
+#if (ISR_DISPATCH_MAX_SUBSCRIBERS < 1)
+#error "ISR_DISPATCH_MAX_SUBSCRIBERS must be 1 at least"
+#endif
+
+/*
+ * Call all the subscribers of a list from its ISR, with one subscriber per
+ * vector the list is expanded in the ISR: no loop and no call to
+ * IsrDispatch_run, only the indirect call through the pointer in the list
+ * (a hook of isr_hooks.h is the only handler bound at compile time)
+ */
+#if (ISR_DISPATCH_MAX_SUBSCRIBERS == 1)
+#define ISR_DISPATCH_RUN(LIST) \
+	do \
+	{ \
+		if((LIST).count != 0) \
+		{ \
+			if((LIST).subscriber[0].handler != NULL_PTR) \
+			{ \
+				(*(LIST).subscriber[0].handler)((LIST).subscriber[0].context); \
+			} \
+			else \
+			{ \
+				(*(LIST).subscriber[0].callBack)(); \
+			} \
+		} \
+	}while(0)
+#else
+#define ISR_DISPATCH_RUN(LIST)                      IsrDispatch_run(&(LIST))
+#endif
+
+/**************************************************************************
+ *                          Types Declaration                             *
+ * ************************************************************************/
+/*
+ * A subscriber is a handler with its context, or a call back of the old
+ * Xxx_setCallBack API (handler NULL_PTR) kept as it is, so it is called
+ * directly without an adapter
+ */
+typedef struct
+{
+	void (*handler)(void *a_context);
+	void (*callBack)(void);
+	void *context;
+}IsrDispatch_SubscriberType;
+
+/*
+ * Subscribers are kept packed at the start of the table in the order they subscribed
+ */
+typedef struct
+{
+	IsrDispatch_SubscriberType subscriber[ISR_DISPATCH_MAX_SUBSCRIBERS];
+	uint8 count;
+}IsrDispatch_ListType;
+
+/**************************************************************************
+ *                          Functions Prototypes                          *
+ * ************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: IsrDispatch_subscribe
+ *
+ * [Description]:  Function to add a handler to the list of a vector, subscribing the same
+ *                 handler & context again does nothing
+ *
+ * [Args]:         a_list, a_handler, a_context
+ *
+ * [In]            a_list:    Pointer to the list of the vector
+ *                 a_handler: Function called from the ISR with a_context
+ *                 a_context: Pointer passed back to the handler, may be NULL_PTR
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the list is full
+ ***************************************************************************************************/
+bool IsrDispatch_subscribe(IsrDispatch_ListType *a_list, void (*a_handler)(void *a_context), void *a_context);
+/***************************************************************************************************
+ * [Function Name]: IsrDispatch_unsubscribe
+ *
+ * [Description]:  Function to remove a handler & context pair from the list of a vector
+ *
+ * [Args]:         a_list, a_handler, a_context
+ *
+ * [In]            a_list:    Pointer to the list of the vector
+ *                 a_handler: Function given to IsrDispatch_subscribe
+ *                 a_context: Context given to IsrDispatch_subscribe
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void IsrDispatch_unsubscribe(IsrDispatch_ListType *a_list, void (*a_handler)(void *a_context), void *a_context);
+/***************************************************************************************************
+ * [Function Name]: IsrDispatch_run
+ *
+ * [Description]:  Function to call all the subscribers of a list, called from the ISR
+ *                 through ISR_DISPATCH_RUN
+ *
+ * [Args]:         a_list
+ *
+ * [In]            a_list: Pointer to the list of the vector
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void IsrDispatch_run(const IsrDispatch_ListType *a_list);
+/***************************************************************************************************
+ * [Function Name]: IsrDispatch_setCallBack
+ *
+ * [Description]:  Function to keep the old Xxx_setCallBack(void(*)(void)) drivers API on top of
+ *                 the lists, the call back replaces the one set before in the list and is
+ *                 called directly by the ISR, NULL_PTR removes it
+ *
+ * [Args]:         a_list, a_ptr
+ *
+ * [In]            a_list: Pointer to the list of the vector
+ *                 a_ptr:  Call back function of the application
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the list is full
+ ***************************************************************************************************/
+bool IsrDispatch_setCallBack(IsrDispatch_ListType *a_list, void (*a_ptr)(void));
+
+#endif /* ISR_DISPATCH_H_ */
@@ -0,0 +1,54 @@
+/**********************************************************************************
+ * [FILE NAME]: isr_hooks.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: File of the handlers bound to the interrupt vectors at compile
+ *                time, the timer and external interrupt drivers expand a defined
+ *                XXX_HOOK() inside the ISR instead of calling the subscribers list
+ *                of the vector through pointers. The drivers name no application
+ *                symbol, the hooks are defined by the application in
+ *                isr_hooks_config.h
+ *
+ ***********************************************************************************/
+#ifndef ISR_HOOKS_H_
+#define ISR_HOOKS_H_
+
+#include "std_types.h"
+
+/**************************************************************************
+ *                          Preprocessor Macros                           *
+ * ************************************************************************/
+/*
+ * ISR_HOOKS TRUE  --> the vectors with a hook defined call it, their
+ *                     Xxx_setCallBack / Xxx_subscribe have no effect
+ * ISR_HOOKS FALSE --> every vector calls its subscribers list
+ *
+ * Hooks of the vectors (any of them may be defined):
+ * TIMER0_OVF_HOOK, TIMER0_COMP_HOOK, TIMER1_OVF_HOOK, TIMER1_COMPA_HOOK,
+ * TIMER1_COMPB_HOOK, TIMER1_CAPT_HOOK, TIMER2_OVF_HOOK, TIMER2_COMP_HOOK,
+ * INT0_HOOK, INT1_HOOK, INT2_HOOK
+ */
+#include "isr_hooks_config.h"
+
+#ifndef ISR_HOOKS
+#define ISR_HOOKS                               FALSE
+#endif
+
+#if (ISR_HOOKS == FALSE)
+#undef TIMER0_OVF_HOOK
+#undef TIMER0_COMP_HOOK
+#undef TIMER1_OVF_HOOK
+#undef TIMER1_COMPA_HOOK
+#undef TIMER1_COMPB_HOOK
+#undef TIMER1_CAPT_HOOK
+#undef TIMER2_OVF_HOOK
+#undef TIMER2_COMP_HOOK
+#undef INT0_HOOK
+#undef INT1_HOOK
+#undef INT2_HOOK
+#endif
+
+#endif /* ISR_HOOKS_H_ */
@@ -0,0 +1,63 @@
+/**********************************************************************************
+ * [FILE NAME]: isr_hooks_config.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: Configuration of the Digital Clock for isr_hooks.h, the
+ *                application handlers bound to the interrupt vectors at
+ *                compile time
+ *
+ ***********************************************************************************/
+#ifndef ISR_HOOKS_CONFIG_H_
+#define ISR_HOOKS_CONFIG_H_
+
+#include "std_types.h"
+
+/**************************************************************************
+ *                          Preprocessor Macros                           *
+ * ************************************************************************/
+/*
+ * Source of the 1 second tick:
+ * CLOCK_TICK_SOURCE_TIMER1 --> Timer1 from the CPU clock (default)
+ * CLOCK_TICK_SOURCE_RTC    --> Timer2 asynchronous from a 32.768KHz
+ *                              watch crystal on TOSC1/TOSC2
+ */
+#define CLOCK_TICK_SOURCE_TIMER1                0
+#define CLOCK_TICK_SOURCE_RTC                   1
+
+#ifndef CLOCK_TICK_SOURCE
+#define CLOCK_TICK_SOURCE                       CLOCK_TICK_SOURCE_TIMER1
+#endif
+
+#define ISR_HOOKS                               TRUE
+
+#if (ISR_HOOKS == TRUE)
+/*
+ * The hooks expand application code, the drivers see it only here
+ */
+#include "app_hooks.h"
+
+/*
+ * Only the interrupt of the selected tick source counts the seconds
+ */
+#if (CLOCK_TICK_SOURCE == CLOCK_TICK_SOURCE_RTC)
+#define TIMER2_OVF_HOOK()                       CLOCK_TICK_HOOK()
+#else
+#define TIMER1_COMPA_HOOK()                     CLOCK_TICK_HOOK()
+#endif
+/*
+ * The buttons only post their event, the main loop handles it
+ */
+#define INT0_HOOK()                             EVENT_QUEUE_POST(EVENT_RIGHT)
+#define INT1_HOOK()                             EVENT_QUEUE_POST(EVENT_LEFT)
+#define INT2_HOOK()                             EVENT_QUEUE_POST(EVENT_OK)
+/*
+ * The system tick is expanded in the ISR, only the LCD, software timer
+ * and lock out services are called
+ */
+#define TIMER0_COMP_HOOK()                      SYSTEM_TICK_HOOK()
+#endif
+
+#endif /* ISR_HOOKS_CONFIG_H_ */
@@ -12,6 +12,242 @@
 
 #include "lcd.h"
 
+/*******************************************************************************
+ *                           Global Variables                                  *
+ *******************************************************************************/
+/* Characters requested by the application through the LCD_buffer functions */
+static uint8 g_lcdFrameBuffer[LCD_ROWS][LCD_COLUMNS];
+
+/* Characters currently held in the LCD DDRAM (shadow of the controller memory) */
+static uint8 g_lcdShadow[LCD_ROWS][LCD_COLUMNS];
+
+/* One bit per column, set when the frame buffer cell differs from the shadow */
+static LCD_CellMaskType g_lcdDirtyCells[LCD_ROWS];
+
+/* Set when the busy flag did not clear in time, the driver then uses fixed delays */
+static volatile bool g_lcdBusyFlagTimeout = FALSE;
+
+/* Last display on/off, cursor and blink command sent to the LCD */
+static uint8 g_lcdDisplayControl = LCD_UNKNOWN_STATE;
+
+/* Current DDRAM address counter of the LCD */
+static uint8 g_lcdAddress = LCD_UNKNOWN_STATE;
+
+/* Number of display control and set address commands skipped as redundant */
+static uint16 g_lcdElidedControlCommands = 0;
+static uint16 g_lcdElidedAddressCommands = 0;
+
+#if (LCD_ASYNC_QUEUE == TRUE)
+/* Ring buffer of the bytes waiting to be sent by LCD_serviceQueue */
+static volatile uint16 g_lcdQueue[LCD_QUEUE_SIZE];
+
+/* Index of the next free entry, written by the application only */
+static volatile uint8 g_lcdQueueHead = 0;
+
+/* Index of the next entry to send, written by LCD_serviceQueue only */
+static volatile uint8 g_lcdQueueTail = 0;
+
+/* Number of service calls to skip while a slow instruction executes without busy flag */
+static volatile uint8 g_lcdQueueHoldoff = 0;
+#endif
+
+/*******************************************************************************
+ *                      Private Functions Definitions                          *
+ *******************************************************************************/
+static void LCD_resetShadow(void)
+{
+	uint8 row;
+	uint8 col;
+
+	/* after a clear command the whole DDRAM holds blanks */
+	for(row = 0; row < LCD_ROWS; row++)
+	{
+		for(col = 0; col < LCD_COLUMNS; col++)
+		{
+			g_lcdFrameBuffer[row][col] = LCD_BLANK_CHARACTER;
+			g_lcdShadow[row][col] = LCD_BLANK_CHARACTER;
+		}
+		g_lcdDirtyCells[row] = 0;
+	}
+}
+
+/*
+ * DDRAM address following addr after a character is written, the two
+ * lines of the LCD are 0x00-0x27 and 0x40-0x67.
+ */
+static uint8 LCD_nextAddress(uint8 addr)
+{
+	addr++;
+	if(addr == LCD_LINE1_END_ADDRESS)
+	{
+		addr = LCD_LINE2_START_ADDRESS;
+	}
+	else if(addr == LCD_LINE2_END_ADDRESS)
+	{
+		addr = LCD_LINE1_START_ADDRESS;
+	}
+	return addr;
+}
+
+/*
+ * Remove the whole multiples of power from value and return how many
+ * were removed, used instead of the library division for 0..99 values.
+ */
+static uint8 LCD_extractDigit(uint8 *value,uint8 power)
+{
+	uint8 digit = 0;
+
+	while((*value) >= power)
+	{
+		(*value) -= power;
+		digit++;
+	}
+
+	return digit;
+}
+
+/*
+ * Read the busy flag of the LCD once, returns TRUE while the LCD
+ * is still executing the previous instruction.
+ */
+static bool LCD_readBusyFlag(void)
+{
+	bool busy;
+
+	LCD_DATA_PORT_DIR = 0x00; /* Configure the data port as input port to read the busy flag */
+	CLEAR_BIT(LCD_CTRL_PORT,RS); /* Instruction Mode RS=0 */
+	SET_BIT(LCD_CTRL_PORT,RW); /* read from LCD so RW=1 */
+	SET_BIT(LCD_CTRL_PORT,E); /* Enable LCD E=1 */
+	_delay_us(1); /* delay for processing Tddr = 160ns */
+	busy = BIT_IS_SET(LCD_DATA_PORT_IN,LCD_BUSY_FLAG_PIN) ? TRUE : FALSE; /* read the busy flag from D7 */
+	CLEAR_BIT(LCD_CTRL_PORT,E); /* disable LCD E=0 */
+	_delay_us(1); /* delay for processing Tc = 500ns */
+	CLEAR_BIT(LCD_CTRL_PORT,RW); /* back to write mode RW=0 */
+	LCD_DATA_PORT_DIR = 0xFF; /* Configure the data port as output port again */
+
+	return busy;
+}
+
+/*
+ * Poll the busy flag of the LCD until the previous instruction is executed.
+ * Returns FALSE if the flag did not clear within LCD_BUSY_TIMEOUT_US.
+ */
+static bool LCD_waitWhileBusy(void)
+{
+	uint16 polls = LCD_BUSY_TIMEOUT_US / 2; /* every poll takes at least 2us */
+	bool busy;
+
+	do
+	{
+		busy = LCD_readBusyFlag();
+		polls--;
+	}while(busy && (polls != 0));
+
+	return (busy ? FALSE : TRUE);
+}
+
+/*
+ * Latch one byte into the LCD without any waiting, rs selects the
+ * instruction register (0) or the data register (1).
+ */
+static void LCD_strobeByte(uint8 rs,uint8 byte)
+{
+	if(rs)
+	{
+		SET_BIT(LCD_CTRL_PORT,RS); /* Data Mode RS=1 */
+	}
+	else
+	{
+		CLEAR_BIT(LCD_CTRL_PORT,RS); /* Instruction Mode RS=0 */
+	}
+	CLEAR_BIT(LCD_CTRL_PORT,RW); /* write data to LCD so RW=0 */
+	_delay_us(1); /* delay for processing Tas = 50ns */
+	SET_BIT(LCD_CTRL_PORT,E); /* Enable LCD E=1 */
+	LCD_DATA_PORT = byte; /* out the required byte to the data bus D0 --> D7 */
+	_delay_us(1); /* delay for processing Tpw = 230ns */
+	CLEAR_BIT(LCD_CTRL_PORT,E); /* disable LCD E=0, Th = 10ns is covered by the next instruction */
+}
+
+/* Check if the byte is one of the slow instructions (clear / return home) */
+static bool LCD_isLongInstruction(uint8 rs,uint8 byte)
+{
+	return ((rs == 0) && ((byte == CLEAR_COMMAND) || (byte == RETURN_HOME_COMMAND))) ? TRUE : FALSE;
+}
+
+/*
+ * Send one byte to the LCD and block until the LCD can accept it.
+ */
+static void LCD_writeByte(uint8 rs,uint8 byte)
+{
+	if(g_lcdBusyFlagTimeout == FALSE)
+	{
+		/* wait for the previous byte, fall back to fixed delays if BF never clears */
+		if(LCD_waitWhileBusy() == FALSE)
+		{
+			g_lcdBusyFlagTimeout = TRUE;
+		}
+	}
+
+	LCD_strobeByte(rs,byte);
+
+	if(g_lcdBusyFlagTimeout == TRUE)
+	{
+		/* no busy flag, wait the worst case execution time of the byte */
+		if(LCD_isLongInstruction(rs,byte))
+		{
+			_delay_ms(LCD_FALLBACK_LONG_DELAY_MS);
+		}
+		else
+		{
+			_delay_us(LCD_FALLBACK_DELAY_US);
+		}
+	}
+}
+
+#if (LCD_ASYNC_QUEUE == TRUE)
+/*
+ * Send the oldest queued byte from the application context, used when
+ * the queue is full. Must be called with the interrupts disabled.
+ */
+static void LCD_drainOneByte(void)
+{
+	uint16 entry = g_lcdQueue[g_lcdQueueTail];
+
+	if(g_lcdQueueHoldoff != 0)
+	{
+		/* a slow instruction sent by the ISR may still be executing */
+		_delay_ms(LCD_FALLBACK_LONG_DELAY_MS);
+		g_lcdQueueHoldoff = 0;
+	}
+	LCD_writeByte(LCD_QUEUE_ENTRY_RS(entry),LCD_QUEUE_ENTRY_BYTE(entry));
+	g_lcdQueueTail = (g_lcdQueueTail + 1) & LCD_QUEUE_MASK;
+}
+
+/*
+ * Add one byte to the write queue, if the queue is full the oldest
+ * byte is sent immediately to make room for the new one.
+ */
+static void LCD_enqueue(uint8 rs,uint8 byte)
+{
+	uint8 next = (g_lcdQueueHead + 1) & LCD_QUEUE_MASK;
+	uint8 sreg;
+
+	while(next == g_lcdQueueTail)
+	{
+		sreg = SREG;
+		cli(); /* the ISR must not drive the bus at the same time */
+		if(next == g_lcdQueueTail)
+		{
+			LCD_drainOneByte();
+		}
+		SREG = sreg;
+	}
+
+	g_lcdQueue[g_lcdQueueHead] = LCD_QUEUE_ENTRY(rs,byte);
+	g_lcdQueueHead = next; /* publish the entry only after it is written */
+}
+#endif
+
 /*******************************************************************************
  *                      Functions Definitions                                  *
  *******************************************************************************/
@@ -19,40 +255,129 @@ void LCD_init(void)
 {
 	LCD_DATA_PORT_DIR = 0xFF; /* Configure the data port as output port */ 
 	LCD_CTRL_PORT_DIR |= (1<<E) | (1<<RS) | (1<<RW); /* Configure the control pins(E,RS,RW) as output pins */
+	CLEAR_BIT(LCD_CTRL_PORT,E); /* keep the LCD disabled E=0 */
+
+	_delay_ms(LCD_POWER_ON_DELAY_MS); /* the busy flag can not be checked before the function set */
 	
-	LCD_sendCommand(TWO_LINE_LCD_Eight_BIT_MODE); /* use 2-line lcd + 8-bit Data Mode + 5*7 dot display Mode */
+	/*
+	 * Send the function set without polling, BF may read busy until then and
+	 * a timeout would leave the driver on the fixed delays for good
+	 */
+	LCD_strobeByte(0,TWO_LINE_LCD_Eight_BIT_MODE); /* use 2-line lcd + 8-bit Data Mode + 5*7 dot display Mode */
+	_delay_us(LCD_FALLBACK_DELAY_US); /* execution time of the function set */
 	
-	LCD_sendCommand(CURSOR_OFF); /* cursor off */
+	LCD_writeByte(0,CURSOR_OFF); /* cursor off, the busy flag is polled from here on */
 	
-	LCD_sendCommand(CLEAR_COMMAND); /* clear LCD at the beginning */
+	LCD_writeByte(0,CLEAR_COMMAND); /* clear LCD at the beginning */
+
+	g_lcdDisplayControl = CURSOR_OFF; /* state of the LCD after the init sequence */
+	g_lcdAddress = LCD_LINE1_START_ADDRESS;
+
+	LCD_resetShadow(); /* the shadow now matches the cleared DDRAM */
 }
 
 void LCD_sendCommand(uint8 command)
 {
-	CLEAR_BIT(LCD_CTRL_PORT,RS); /* Instruction Mode RS=0 */
-	CLEAR_BIT(LCD_CTRL_PORT,RW); /* write data to LCD so RW=0 */
-	_delay_ms(1); /* delay for processing Tas = 50ns */
-	SET_BIT(LCD_CTRL_PORT,E); /* Enable LCD E=1 */
-	_delay_ms(1); /* delay for processing Tpw - Tdws = 190ns */
-	LCD_DATA_PORT = command; /* out the required command to the data bus D0 --> D7 */
-	_delay_ms(1); /* delay for processing Tdsw = 100ns */
-	CLEAR_BIT(LCD_CTRL_PORT,E); /* disable LCD E=0 */
-	_delay_ms(1); /* delay for processing Th = 13ns */
+	if((command & SET_CURSOR_LOCATION) != 0)
+	{
+		/* skip moving the cursor to where it already is */
+		if((command & (uint8)(~SET_CURSOR_LOCATION)) == g_lcdAddress)
+		{
+			g_lcdElidedAddressCommands++;
+			return;
+		}
+		g_lcdAddress = command & (uint8)(~SET_CURSOR_LOCATION);
+	}
+	else if((command & LCD_DISPLAY_CONTROL_MASK) == LCD_DISPLAY_CONTROL_COMMAND)
+	{
+		/* skip display/cursor/blink commands which do not change anything */
+		if(command == g_lcdDisplayControl)
+		{
+			g_lcdElidedControlCommands++;
+			return;
+		}
+		g_lcdDisplayControl = command;
+	}
+	else if((command == CLEAR_COMMAND) || (command == RETURN_HOME_COMMAND))
+	{
+		g_lcdAddress = LCD_LINE1_START_ADDRESS;
+	}
+	else
+	{
+		/* shift, entry mode and CGRAM commands may move the address counter */
+		g_lcdAddress = LCD_UNKNOWN_STATE;
+	}
+
+#if (LCD_ASYNC_QUEUE == TRUE)
+	LCD_enqueue(0,command); /* Instruction Mode RS=0 */
+#else
+	LCD_writeByte(0,command); /* Instruction Mode RS=0 */
+#endif
 }
 
 void LCD_displayCharacter(uint8 data)
 {
-	SET_BIT(LCD_CTRL_PORT,RS); /* Data Mode RS=1 */
-	CLEAR_BIT(LCD_CTRL_PORT,RW); /* write data to LCD so RW=0 */
-	_delay_ms(1); /* delay for processing Tas = 50ns */
-	SET_BIT(LCD_CTRL_PORT,E); /* Enable LCD E=1 */
-	_delay_ms(1); /* delay for processing Tpw - Tdws = 190ns */
-	LCD_DATA_PORT = data; /* out the required data char to the data bus D0 --> D7 */
-	_delay_ms(1); /* delay for processing Tdsw = 100ns */
-	CLEAR_BIT(LCD_CTRL_PORT,E); /* disable LCD E=0 */
-	_delay_ms(1); /* delay for processing Th = 13ns */	
+	if(g_lcdAddress != LCD_UNKNOWN_STATE)
+	{
+		g_lcdAddress = LCD_nextAddress(g_lcdAddress); /* the LCD auto increments the address */
+	}
+
+#if (LCD_ASYNC_QUEUE == TRUE)
+	LCD_enqueue(1,data); /* Data Mode RS=1 */
+#else
+	LCD_writeByte(1,data); /* Data Mode RS=1 */
+#endif
 }
 
+#if (LCD_ASYNC_QUEUE == TRUE)
+void LCD_serviceQueue(void)
+{
+	uint16 entry;
+
+	if(g_lcdQueueTail == g_lcdQueueHead)
+	{
+		return; /* nothing to send */
+	}
+
+	if(g_lcdBusyFlagTimeout == TRUE)
+	{
+		/* no busy flag, leave the LCD enough service periods for slow instructions */
+		if(g_lcdQueueHoldoff != 0)
+		{
+			g_lcdQueueHoldoff--;
+			return;
+		}
+	}
+	else if(LCD_readBusyFlag() == TRUE)
+	{
+		return; /* try again in the next service period */
+	}
+
+	entry = g_lcdQueue[g_lcdQueueTail];
+	LCD_strobeByte(LCD_QUEUE_ENTRY_RS(entry),LCD_QUEUE_ENTRY_BYTE(entry));
+	if(LCD_isLongInstruction(LCD_QUEUE_ENTRY_RS(entry),LCD_QUEUE_ENTRY_BYTE(entry)))
+	{
+		g_lcdQueueHoldoff = LCD_QUEUE_LONG_HOLDOFF;
+	}
+	g_lcdQueueTail = (g_lcdQueueTail + 1) & LCD_QUEUE_MASK;
+}
+
+bool LCD_isFlushComplete(void)
+{
+	return (g_lcdQueueTail == g_lcdQueueHead) ? TRUE : FALSE;
+}
+#else
+void LCD_serviceQueue(void)
+{
+	/* nothing to do, every write blocks until it is sent */
+}
+
+bool LCD_isFlushComplete(void)
+{
+	return TRUE; /* every write blocks until it is sent */
+}
+#endif
+
 void LCD_displayString(const char *Str)
 {
 	uint8 i = 0;
@@ -72,27 +397,12 @@ void LCD_displayString(const char *Str)
 
 void LCD_goToRowColumn(uint8 row,uint8 col)
 {
-	uint8 Address;
-	
-	/* first of all calculate the required address */
-	switch(row)
-	{
-		case 0:
-				Address=col;
-				break;
-		case 1:
-				Address=col+0x40;
-				break;
-		case 2:
-				Address=col+0x14;
-				break;
-		case 3:
-				Address=col+0x54;
-				break;
-	}					
+	/* DDRAM address of the first column of every row */
+	static const uint8 rowOffsets[LCD_ROWS] = LCD_ROW_OFFSETS;
+
 	/* to write to a specific address in the LCD 
 	 * we need to apply the corresponding command 0b10000000+Address */
-	LCD_sendCommand(Address | SET_CURSOR_LOCATION); 
+	LCD_sendCommand((uint8)(rowOffsets[row & (LCD_ROWS - 1)] + col) | SET_CURSOR_LOCATION); 
 }
 
 void LCD_displayStringRowColumn(uint8 row,uint8 col,const char *Str)
@@ -101,14 +411,165 @@ void LCD_displayStringRowColumn(uint8 row,uint8 col,const char *Str)
 	LCD_displayString(Str); /* display the string */
 }
 
+void LCD_writeRun(uint8 row,uint8 col,const uint8 *buf,uint8 len)
+{
+	LCD_goToRowColumn(row,col); /* set the DDRAM address once for the whole run */
+	while(len != 0)
+	{
+		LCD_displayCharacter(*buf); /* the LCD increments the DDRAM address after every character */
+		buf++;
+		len--;
+	}
+}
+
 void LCD_intgerToString(int data)
 {
-   char buff[16]; /* String to hold the ascii result */
-   itoa(data,buff,10); /* 10 for decimal */
-   LCD_displayString(buff);
+	if(data < 0)
+	{
+		LCD_displayCharacter('-');
+		LCD_displayUnsigned((uint16)0 - (uint16)data,0); /* magnitude, also valid for the most negative value */
+	}
+	else
+	{
+		LCD_displayUnsigned((uint16)data,0);
+	}
+}
+
+void LCD_displayDigit(uint8 digit)
+{
+	LCD_displayCharacter(LCD_DIGIT_TO_ASCII(digit));
+}
+
+void LCD_displayTwoDigits(uint8 value)
+{
+	uint8 tens = LCD_extractDigit(&value,10); /* value keeps the units */
+
+	LCD_displayCharacter(LCD_DIGIT_TO_ASCII(tens));
+	LCD_displayCharacter(LCD_DIGIT_TO_ASCII(value));
+}
+
+void LCD_displayUnsigned(uint16 value,uint8 width)
+{
+	/* powers of ten of the uint16 range, most significant first */
+	static const uint16 powers[LCD_UINT16_DIGITS] = {10000,1000,100,10,1};
+	uint8 i;
+	uint8 digit;
+	bool leadingZero = TRUE;
+
+	/* zero padding beyond the digits a uint16 can hold */
+	for(i = LCD_UINT16_DIGITS; i < width; i++)
+	{
+		LCD_displayCharacter('0');
+	}
+
+	for(i = 0; i < LCD_UINT16_DIGITS; i++)
+	{
+		digit = 0;
+		while(value >= powers[i])
+		{
+			value -= powers[i]; /* repeated subtraction, at most 9 per digit */
+			digit++;
+		}
+
+		/* print the digit once the number started, inside the width or for the last digit */
+		if((digit != 0) || ((LCD_UINT16_DIGITS - i) <= width) || (i == (LCD_UINT16_DIGITS - 1)))
+		{
+			leadingZero = FALSE;
+		}
+		if(leadingZero == FALSE)
+		{
+			LCD_displayCharacter(LCD_DIGIT_TO_ASCII(digit));
+		}
+	}
+}
+
+void LCD_bufferDigit(uint8 row,uint8 col,uint8 digit)
+{
+	LCD_bufferCharacter(row,col,LCD_DIGIT_TO_ASCII(digit));
+}
+
+void LCD_bufferTwoDigits(uint8 row,uint8 col,uint8 value)
+{
+	uint8 tens = LCD_extractDigit(&value,10); /* value keeps the units */
+
+	LCD_bufferCharacter(row,col,LCD_DIGIT_TO_ASCII(tens));
+	LCD_bufferCharacter(row,col+1,LCD_DIGIT_TO_ASCII(value));
+}
+
+uint16 LCD_getElidedControlCommands(void)
+{
+	return g_lcdElidedControlCommands;
+}
+
+uint16 LCD_getElidedAddressCommands(void)
+{
+	return g_lcdElidedAddressCommands;
 }
 
 void LCD_clearScreen(void)
 {
 	LCD_sendCommand(CLEAR_COMMAND); //clear display 
+	LCD_resetShadow();
+}
+
+void LCD_bufferCharacter(uint8 row,uint8 col,uint8 data)
+{
+	if((row >= LCD_ROWS) || (col >= LCD_COLUMNS))
+	{
+		return; /* ignore cells outside the display */
+	}
+
+	g_lcdFrameBuffer[row][col] = data;
+
+	/* the cell is dirty only while it differs from what the LCD already shows */
+	if(g_lcdShadow[row][col] != data)
+	{
+		g_lcdDirtyCells[row] |= LCD_CELL_BIT(col);
+	}
+	else
+	{
+		g_lcdDirtyCells[row] &= (LCD_CellMaskType)(~LCD_CELL_BIT(col));
+	}
+}
+
+void LCD_bufferStringRowColumn(uint8 row,uint8 col,const char *Str)
+{
+	while((*Str) != '\0')
+	{
+		LCD_bufferCharacter(row,col,*Str);
+		col++;
+		Str++;
+	}
+}
+
+void LCD_flush(void)
+{
+	uint8 row;
+	uint8 col;
+	uint8 start;
+
+	for(row = 0; row < LCD_ROWS; row++)
+	{
+		col = 0;
+		while(g_lcdDirtyCells[row] != 0)
+		{
+			/* skip the clean cells */
+			while((g_lcdDirtyCells[row] & LCD_CELL_BIT(col)) == 0)
+			{
+				col++;
+			}
+
+			/* collect the run of contiguous dirty cells */
+			start = col;
+			while((col < LCD_COLUMNS) && (g_lcdDirtyCells[row] & LCD_CELL_BIT(col)))
+			{
+				g_lcdShadow[row][col] = g_lcdFrameBuffer[row][col];
+				g_lcdDirtyCells[row] &= (LCD_CellMaskType)(~LCD_CELL_BIT(col));
+				col++;
+			}
+
+			/* send the whole run with a single address command */
+			LCD_writeRun(row,start,&g_lcdFrameBuffer[row][start],col - start);
+		}
+	}
 }
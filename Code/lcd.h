@@ -29,13 +29,104 @@
 
 #define LCD_DATA_PORT PORTC
 #define LCD_DATA_PORT_DIR DDRC
+#define LCD_DATA_PORT_IN PINC
+#define LCD_BUSY_FLAG_PIN PC7
+
+/* LCD Timing */
+#define LCD_POWER_ON_DELAY_MS 15      /* wait for the controller internal reset after power on */
+#define LCD_BUSY_TIMEOUT_US 5000      /* give up polling the busy flag after this time */
+#define LCD_FALLBACK_DELAY_US 50      /* fixed wait per byte when the busy flag can not be read */
+#define LCD_FALLBACK_LONG_DELAY_MS 2  /* fixed wait for clear/return home when the busy flag can not be read */
+
+/* LCD Asynchronous Write Queue
+ * when enabled LCD_sendCommand/LCD_displayCharacter only queue the byte and
+ * LCD_serviceQueue must be called periodically (every ~1ms, never faster than
+ * 50us) from a timer interrupt to send the queued bytes one by one */
+#define LCD_ASYNC_QUEUE TRUE
+#define LCD_QUEUE_SIZE 32             /* must be a power of 2 */
+#define LCD_QUEUE_MASK (LCD_QUEUE_SIZE - 1)
+#define LCD_QUEUE_LONG_HOLDOFF 3      /* service periods to wait after clear/return home without busy flag */
+
+#define LCD_QUEUE_ENTRY(RS_VALUE,BYTE) ((uint16)(((uint16)(RS_VALUE)<<8) | (uint8)(BYTE)))
+#define LCD_QUEUE_ENTRY_RS(ENTRY) ((uint8)((ENTRY)>>8))
+#define LCD_QUEUE_ENTRY_BYTE(ENTRY) ((uint8)(ENTRY))
+
+/* LCD Numbers */
+#define LCD_DIGIT_TO_ASCII(DIGIT) ((uint8)((DIGIT) + '0'))
+#define LCD_UINT16_DIGITS 5
 
 /* LCD Commands */
 #define CLEAR_COMMAND 0x01
+#define RETURN_HOME_COMMAND 0x02
 #define TWO_LINE_LCD_Eight_BIT_MODE 0x38
 #define CURSOR_OFF 0x0C
 #define CURSOR_ON 0x0E
 #define SET_CURSOR_LOCATION 0x80 
+#define LCD_DISPLAY_CONTROL_COMMAND 0x08 /* 0b00001DCB display on, cursor on, blink on */
+#define LCD_DISPLAY_CONTROL_MASK 0xF8
+
+/* LCD DDRAM Addresses */
+#define LCD_LINE1_START_ADDRESS 0x00
+#define LCD_LINE1_END_ADDRESS 0x28
+#define LCD_LINE2_START_ADDRESS 0x40
+#define LCD_LINE2_END_ADDRESS 0x68
+#define LCD_UNKNOWN_STATE 0xFF
+
+/* LCD Geometry, choose one of the supported LCD modules */
+#define LCD_GEOMETRY_16X2 0
+#define LCD_GEOMETRY_20X4 1
+#define LCD_GEOMETRY_16X4 2
+#define LCD_GEOMETRY LCD_GEOMETRY_16X2
+
+#if (LCD_GEOMETRY == LCD_GEOMETRY_16X2)
+#define LCD_ROWS 2
+#define LCD_COLUMNS 16
+#define LCD_ROW0_OFFSET 0x00
+#define LCD_ROW1_OFFSET 0x40
+#define LCD_ROW_OFFSETS {LCD_ROW0_OFFSET,LCD_ROW1_OFFSET}
+#elif (LCD_GEOMETRY == LCD_GEOMETRY_20X4)
+#define LCD_ROWS 4
+#define LCD_COLUMNS 20
+#define LCD_ROW0_OFFSET 0x00
+#define LCD_ROW1_OFFSET 0x40
+#define LCD_ROW2_OFFSET 0x14
+#define LCD_ROW3_OFFSET 0x54
+#define LCD_ROW_OFFSETS {LCD_ROW0_OFFSET,LCD_ROW1_OFFSET,LCD_ROW2_OFFSET,LCD_ROW3_OFFSET}
+#elif (LCD_GEOMETRY == LCD_GEOMETRY_16X4)
+#define LCD_ROWS 4
+#define LCD_COLUMNS 16
+#define LCD_ROW0_OFFSET 0x00
+#define LCD_ROW1_OFFSET 0x40
+#define LCD_ROW2_OFFSET 0x10
+#define LCD_ROW3_OFFSET 0x50
+#define LCD_ROW_OFFSETS {LCD_ROW0_OFFSET,LCD_ROW1_OFFSET,LCD_ROW2_OFFSET,LCD_ROW3_OFFSET}
+#else
+#error "LCD_GEOMETRY must be LCD_GEOMETRY_16X2, LCD_GEOMETRY_20X4 or LCD_GEOMETRY_16X4"
+#endif
+
+#define LCD_BLANK_CHARACTER ' '
+
+/* One bit per column of a row, wide enough for the configured geometry */
+#if (LCD_COLUMNS > 16)
+typedef uint32 LCD_CellMaskType;
+#else
+typedef uint16 LCD_CellMaskType;
+#endif
+#define LCD_CELL_BIT(COL) ((LCD_CellMaskType)((LCD_CellMaskType)1<<(COL)))
+
+/* LCD Compile Time Addressing
+ * with constant row and column the whole set cursor command folds to
+ * one constant byte, a constant row with a variable column folds to one addition */
+#if (LCD_ROWS == 2)
+#define LCD_ROW_OFFSET(ROW) ((ROW) == 0 ? LCD_ROW0_OFFSET : LCD_ROW1_OFFSET)
+#else
+#define LCD_ROW_OFFSET(ROW) ((ROW) == 0 ? LCD_ROW0_OFFSET : \
+                             (ROW) == 1 ? LCD_ROW1_OFFSET : \
+                             (ROW) == 2 ? LCD_ROW2_OFFSET : LCD_ROW3_OFFSET)
+#endif
+#define LCD_DDRAM_ADDRESS(ROW,COL) ((uint8)(LCD_ROW_OFFSET(ROW) + (COL)))
+#define LCD_SET_CURSOR_COMMAND(ROW,COL) ((uint8)(SET_CURSOR_LOCATION | LCD_DDRAM_ADDRESS(ROW,COL)))
+#define LCD_GO_TO_ROW_COLUMN(ROW,COL) LCD_sendCommand(LCD_SET_CURSOR_COMMAND(ROW,COL))
 
 /*******************************************************************************
  *                      Functions Prototypes                                   *
@@ -47,6 +138,19 @@ void LCD_init(void);
 void LCD_clearScreen(void);
 void LCD_displayStringRowColumn(uint8 row,uint8 col,const char *Str);
 void LCD_goToRowColumn(uint8 row,uint8 col);
+void LCD_writeRun(uint8 row,uint8 col,const uint8 *buf,uint8 len);
 void LCD_intgerToString(int data);
+void LCD_displayDigit(uint8 digit);
+void LCD_displayTwoDigits(uint8 value);
+void LCD_displayUnsigned(uint16 value,uint8 width);
+void LCD_bufferDigit(uint8 row,uint8 col,uint8 digit);
+void LCD_bufferTwoDigits(uint8 row,uint8 col,uint8 value);
+void LCD_bufferCharacter(uint8 row,uint8 col,uint8 data);
+void LCD_bufferStringRowColumn(uint8 row,uint8 col,const char *Str);
+void LCD_flush(void);
+void LCD_serviceQueue(void);
+bool LCD_isFlushComplete(void);
+uint16 LCD_getElidedControlCommands(void);
+uint16 LCD_getElidedAddressCommands(void);
 
 #endif /* LCD_H_ */
@@ -14,30 +14,45 @@
  *                       Global Variables                           *
  *******************************************************************/
 /*
- * Variable to check if the interrupt of TIMER1 happen or not
- * global to use it in external function
+ * Free running count of the TIMER1 interrupts, written by the tick
+ * callback only, 8-bit so it is read atomically by the main loop
  */
-bool g_tick = FALSE;
+volatile uint8 g_tickCount = INITIAL_COUNT;
 /*
- * Variable to increment the value of the seconds
- *global to use it in external function
- *
+ * Count of the ticks already added to the clock, written by the
+ * main loop only, the difference with g_tickCount is the pending ticks
  */
-uint8 g_seconds = INITIAL_COUNT;
+volatile uint8 g_processedTicks = INITIAL_COUNT;
 /*
- * Variable to increment the value of the minutes
- * global to use it in external function
- *
+ * Ticks dropped because too many were pending, for diagnostics
  */
-uint8 g_minutes = INITIAL_COUNT;
+volatile uint16 g_lostTicks = INITIAL_COUNT;
 /*
- * Variable to increment the value of the hours
- * global to use it in external function
+ * TRUE while the main loop runs, FALSE while the CPU sleeps
  */
-uint8 g_hours = INITIAL_COUNT;
+volatile bool g_cpuAwake = TRUE;
 /*
- * Variable to carry the position of the cursor on the LCD
- * global to use it in external function
+ * Timer0 ticks sampled in the current duty cycle window and how many
+ * of them found the CPU awake, written by the Timer0 callback only
+ */
+volatile uint16 g_awakeSamples = INITIAL_COUNT;
+volatile uint16 g_dutyCycleSamples = INITIAL_COUNT;
+/*
+ * Awake ticks of the last complete window (per DUTY_CYCLE_WINDOW ticks)
+ */
+volatile uint16 g_lastDutyCycle = INITIAL_COUNT;
+/*
+ * Packed BCD time of the clock, it keeps counting while the time is edited
+ */
+Clock_TimeType g_time = {INITIAL_COUNT, INITIAL_COUNT, INITIAL_COUNT};
+/*
+ * Copy of the time taken when the Set Clock State starts, the UP/DOWN
+ * buttons change it and OK commits it to g_time
+ */
+Clock_TimeType g_editTime = {INITIAL_COUNT, INITIAL_COUNT, INITIAL_COUNT};
+/*
+ * Variable to carry the position of the cursor, the index of the
+ * edited digit in the field table, global to use it in external function
  */
 sint8 g_cursorPosition = INITIAL_POSITION;
 /*
@@ -52,20 +67,36 @@ int main(void)
 	 *                    Variable Declaration and Definitions                     *
 	 *******************************************************************************/
 	/*
-	 * local variable to use it with UP button to make sure that the
-	 * functionality is done one time while pressing the button
+	 * local structure to take the gestures of UP and DOWN buttons
+	 */
+	Button_GestureType gestures;
+	/*
+	 * local variable to collect the buttons which step the digit in this pass
 	 */
-	bool UP_flag = TRUE;
+	uint8 stepButtons;
+	/*
+	 * local variable to take the events posted by the interrupts
+	 */
+	Event_Type event;
 
 	/*
-	 * local variable to use it with down button to make sure that the
-	 * functionality is done one time while pressing the button
+	 * local variable to collect the digits changed since the last
+	 * frame sent to the LCD, the first frame redraws everything
+	 */
+	uint8 changedDigits = ALL_DIGITS_CHANGED;
+	/*
+	 * local variable to know if the cursor is shown, the display control
+	 * command is sent once when the state changes (the LCD starts hidden)
 	 */
-	bool Down_flag = TRUE;
+	bool cursorShown = FALSE;
 	/*
 	 * local structure  to configure the timer module to be able to count
 	 */
 	Timer1_ConfigType clock;
+	/*
+	 * local structure to configure the timer module which sends the queued LCD bytes
+	 */
+	Timer0_ConfigType lcdTimer;
 	/*
 	 * local structure to configure the External Interrupt 0 module to be able to use it
 	 */
@@ -78,22 +109,38 @@ int main(void)
 	 * local structure to configure the External Interrupt 2 module to be able to use it
 	 */
 	INT2_ConfigType  OK;
+	/*
+	 * local structure to configure the long press and the auto-repeat of UP and DOWN buttons
+	 */
+	Button_GestureConfigType editRepeat;
 	/*
 	 * Configure Interrupt 0 to work with falling edge
 	 */
 	right.INT0_senseControl  = INT0_Falling;
+	/*
+	 * Ignore the bouncing of the Right button until it is quiet for BUTTON_LOCKOUT_MS
+	 */
+	right.INT0_lockoutTicks  = BUTTON_LOCKOUT_TICKS;
 	/*
 	 * Configure Interrupt 1 to work with falling edge
 	 */
 	left.INT1_senseControl   = INT1_Falling;
+	/*
+	 * Ignore the bouncing of the Left button until it is quiet for BUTTON_LOCKOUT_MS
+	 */
+	left.INT1_lockoutTicks   = BUTTON_LOCKOUT_TICKS;
 	/*
 	 * Configure Interrupt 2 to work with falling edge
 	 */
 	OK.INT2_senseControl     = INT2_Falling;
+	/*
+	 * Ignore the bouncing of the OK button until it is quiet for BUTTON_LOCKOUT_MS
+	 */
+	OK.INT2_lockoutTicks     = BUTTON_LOCKOUT_TICKS;
 	/*
 	 * Configure timer structure to:
 	 * with initial value --> 0
-	 * with compare value --> 1000
+	 * with compare value --> one second of timer counts
 	 * with mode --> compare
 	 * compare at channel A
 	 * No need for OC1A --> Disconnect
@@ -104,52 +151,66 @@ int main(void)
 	clock.timer1_mode = CTC_OCR1A;
 	clock.channel = ChannelA;
 	clock.Compare_Mode_NonPWM = Disconnected_NonPWM_16;
-	clock.timer1_clock = F_CPU_1024;
-
+	clock.timer1_clock = CLOCK_TIMER_CLOCK;
 	/*
-	 * Configure the Callback function of timer to do
-	 * a specific functionality every interrupt occurrence
-	 * in Timer 1
+	 * Configure LCD timer structure to:
+	 * with initial value --> 0
+	 * with mode --> compare every ~1ms
+	 * No need for OC0 --> Disconnect
 	 */
-	Timer1_setCallBack(tick);
+	lcdTimer.timer0_InitialValue = INITIAL_VALUE;
+	lcdTimer.timer0_compare_MatchValue = LCD_TIMER_COMPARE_VALUE;
+	lcdTimer.timer0_mode = CTC;
+	lcdTimer.Compare_Mode_NonPWM = Disconnected_NonPWM_8;
+	lcdTimer.timer0_clock = LCD_TIMER_CLOCK;
 	/*
-	 * Configure the Callback function of timer to do
-	 * a specific functionality every interrupt occurrence
-	 * for External Interrupt 0
+	 * Configure UP and DOWN buttons to repeat while held, faster and faster
 	 */
-	INT0_setCallBack(Right);
+	editRepeat.longPressMs = BUTTON_LONG_PRESS_MS;
+	editRepeat.repeatIntervalMs = BUTTON_REPEAT_INTERVAL_MS;
+	editRepeat.repeatMinimumMs = BUTTON_REPEAT_MINIMUM_MS;
+	editRepeat.repeatStepMs = BUTTON_REPEAT_STEP_MS;
+
 	/*
-	 * Configure the Callback function of timer to do
-	 * a specific functionality every interrupt occurrence
-	 * for External Interrupt 1
+	 * Configure the Callback functions of the vectors which have no hook bound
+	 * at compile time (isr_hooks_config.h), a bound vector never calls them
 	 */
-	INT1_setCallBack(Left);
+#if (CLOCK_TICK_SOURCE == CLOCK_TICK_SOURCE_RTC)
+#ifndef TIMER2_OVF_HOOK
 	/*
-	 * Configure the Callback function of timer to do
-	 * a specific functionality every interrupt occurrence
-	 * for External Interrupt 2
+	 * Timer 2 counts the seconds of the clock
 	 */
-	INT2_setCallBack(OK_FUNC);
-	/*******************************************************************************
-	 *                             Modules Initialization                          *
-	 *******************************************************************************/
+	Timer2_setCallBack(tick);
+#endif
+#else
+#ifndef TIMER1_COMPA_HOOK
 	/*
-	 * Configure Down button as input pin
+	 * Timer 1 counts the seconds of the clock
 	 */
-	DOWN_BUTTON_DIRECTION_REG = CLEAR_BIT(DOWN_BUTTON_DIRECTION_REG, DOWN_BUTTON_PIN);
-	/*
-	 * Enable internal Pull Up register for Down button
-	 */
-	DOWN_BUTTON_PORT_REG = SET_BIT(DOWN_BUTTON_PORT_REG, DOWN_BUTTON_PIN);
+	Timer1_setCallBack(tick);
+#endif
+#endif
+#ifndef TIMER0_COMP_HOOK
 	/*
-	 * Configure Up button as input pin
+	 * Timer 0 sends the queued LCD bytes one by one and samples the duty cycle
 	 */
-	UP_BUTTON_DIRECTION_REG = CLEAR_BIT(UP_BUTTON_DIRECTION_REG, UP_BUTTON_PIN);
+	Timer0_setCallBack(systemTick);
+#endif
+#ifndef INT0_HOOK
 	/*
-	 * Enable internal Pull Up register for Down button
+	 * External Interrupts 0, 1 and 2 post their button event to the main loop
 	 */
-
-	UP_BUTTON_PORT_REG = SET_BIT(UP_BUTTON_PORT_REG, UP_BUTTON_PIN);
+	INT0_setCallBack(postRight);
+#endif
+#ifndef INT1_HOOK
+	INT1_setCallBack(postLeft);
+#endif
+#ifndef INT2_HOOK
+	INT2_setCallBack(postOK);
+#endif
+	/*******************************************************************************
+	 *                             Modules Initialization                          *
+	 *******************************************************************************/
 	/*
 	 * Initialize LCD to be ready to work
 	 */
@@ -169,7 +230,33 @@ int main(void)
 	/*
 	 * Start timer to count
 	 */
+#if (CLOCK_TICK_SOURCE == CLOCK_TICK_SOURCE_RTC)
+	/*
+	 * Timer2 counts the watch crystal, independent of the CPU clock
+	 */
+	Timer2_RTC_Init();
+#else
 	Timer1_Init(&clock);
+	/*
+	 * Spread the fraction of a count of every second over the
+	 * compare matches so the clock does not drift
+	 */
+	Timer1_setFractionalCompare(CLOCK_TICK_COUNTS, CLOCK_TICK_REMAINDER, CLOCK_TIMER_PRESCALER);
+#endif
+	/*
+	 * Empty the software timers before their tick starts
+	 */
+	SoftTimer_init();
+	/*
+	 * Configure UP and DOWN buttons as input pins with pull up,
+	 * a software timer samples them to filter the bouncing
+	 */
+	Button_init(UP_BUTTON_MASK | DOWN_BUTTON_MASK);
+	Button_setGestureConfig(UP_BUTTON_MASK | DOWN_BUTTON_MASK, &editRepeat);
+	/*
+	 * Start the timer which drains the LCD write queue and ticks the software timers
+	 */
+	Timer0_Init(&lcdTimer);
 	/*
 	 * Enable i-bit in the SREG register
 	 */
@@ -184,133 +271,93 @@ int main(void)
 		 *                          Display The CLOCK                             *
 		 **************************************************************************/
 		/*
-		 * Check if OK button in the default value or not
+		 * Call the function which responsible to calculate the time
+		 * and collect the digits it changed, the clock keeps counting
+		 * while the time is edited
 		 */
-		if(g_OK == TRUE)
+		changedDigits |= DigitalClock();
+		/*
+		 * Handle the button events posted by the interrupts, all the
+		 * state of the clock setting is changed here in the main loop
+		 */
+		while(EventQueue_get(&event) == TRUE)
 		{
-			/*
-			 * Force the LCD to hide the cursor in the default state in displaying clock
-			 */
-			LCD_sendCommand(HIDE_CURSOR_COMMAND);
-			/*
-			 * Call the function which responsible to calculate the time
-			 */
-			DigitalClock();
-			/*
-			 * Call the function which responsible to display the digits of the digital clock
-			 */
-			display();
+			changedDigits |= handleEvent(event);
 		}
-		/**************************************************************************
-		 *                         "Interrupt State"                              *
-		 *                           Set the Clock                                *
-		 **************************************************************************/
-		else
+		/*
+		 * Take the gestures of UP and DOWN buttons every pass, a press steps
+		 * the digit once and a held button keeps stepping it, the steps made
+		 * in the Default State are dropped
+		 */
+		Button_getGestures(&gestures);
+		stepButtons = gestures.pressed | gestures.longPress | gestures.repeat;
+		if(stepButtons & UP_BUTTON_MASK)
+		{
+			changedDigits |= handleEvent(EVENT_UP);
+		}
+		if(stepButtons & DOWN_BUTTON_MASK)
+		{
+			changedDigits |= handleEvent(EVENT_DOWN);
+		}
+		/*
+		 * Check if OK button in the default value or not
+		 */
+		if(g_OK == TRUE)
 		{
 			/*
-			 * Force the LCD to display the cursor to Know which digit you want to reset
-			 */
-			LCD_sendCommand(DISPLAY_CURSOR_COMMAND);
-			/*
-			 * Force the cursor to go left or right in the same row
-			 * depending on the value of the position of the cursor
-			 * this value depend on time of clicks on left or right buttons
+			 * Render a new frame only after the previous one has been sent
+			 * to the LCD, the LCD bytes are sent in the background by Timer0
 			 */
-			LCD_goToRowColumn(DIGITAL_CLOCK_ROW, g_cursorPosition-1);
-			/**************************************************************************
-			 *                              UP Button                                 *
-			 **************************************************************************/
-			if( (BIT_IS_CLEAR(UP_BUTTON_INPUT_REG, UP_BUTTON_PIN))  )
+			if(LCD_isFlushComplete() == TRUE)
 			{
 				/*
-				 * wait some seconds due to bouncing of the button
+				 * Hide the cursor when the default state comes back from setting the clock
 				 */
-				_delay_ms(DEBOUNCE_TIME);
-				/*
-				 * Ask again to make sure it is a real push on the button
-				 */
-				if( BIT_IS_CLEAR(UP_BUTTON_INPUT_REG, UP_BUTTON_PIN) )
+				if(cursorShown == TRUE)
 				{
-					/*
-					 * Ask about the SW flag of UP button to make sure it will do
-					 *the functionality one time only
-					 */
-					if(UP_flag == TRUE)
-					{
-						/*
-						 * Change the state of the UP button to prevent the program
-						 * to enter this area of condition to avoid multiple of this action
-						 * during continuous press
-						 */
-						UP_flag = FALSE;
-						/*
-						 * Call the function of UP button which responsible to
-						 * increase the digit that the cursor point at
-						 */
-						UP_Func();
-						/*
-						 * Call the function which responsible to display the digits of the digital clock
-						 */
-						display();
-					}
+					LCD_sendCommand(HIDE_CURSOR_COMMAND);
+					cursorShown = FALSE;
 				}
-			}
-			else
-			{
 				/*
-				 * Change the state of the UP button to enable the program
-				 * to enter the area of condition once again after releasing the button
+				 * Call the function which responsible to display the digits of the digital clock
 				 */
-				UP_flag = TRUE;
+				display(&g_time, changedDigits);
+				changedDigits = NO_DIGIT_CHANGED;
 			}
-			/**************************************************************************
-			 *                              Down Button                               *
-			 **************************************************************************/
-			if( BIT_IS_CLEAR(DOWN_BUTTON_INPUT_REG, DOWN_BUTTON_PIN) )
+		}
+		/**************************************************************************
+		 *                         "Interrupt State"                              *
+		 *                           Set the Clock                                *
+		 **************************************************************************/
+		else
+		{
+			if(LCD_isFlushComplete() == TRUE)
 			{
 				/*
-				 * wait some seconds due to bouncing of the button
-				 */
-				_delay_ms(DEBOUNCE_TIME);
-				/*
-				 * Ask again to make sure it is a real push on the button
+				 * Display the cursor when entering the state to Know which digit you want to reset
 				 */
-				if( BIT_IS_CLEAR(DOWN_BUTTON_INPUT_REG, DOWN_BUTTON_PIN) )
+				if(cursorShown == FALSE)
 				{
-					/*
-					 *Ask about the SW flag of UP button to make sure it will do
-					 *the functionality one time only
-					 */
-					if(Down_flag == TRUE)
-					{
-						/*
-						 * Change the state of the down button to prevent the program
-						 * to enter this area of condition to avoid multiple of this action
-						 * during continuous press
-						 */
-						Down_flag = FALSE;
-						/*
-						 * Call the function of down button which responsible to
-						 * decrease the digit that the cursor point at
-						 */
-						down_Func();
-						/*
-						 * Call the function which responsible to display the digits of the digital clock
-						 */
-						display();
-					}
+					LCD_sendCommand(DISPLAY_CURSOR_COMMAND);
+					cursorShown = TRUE;
 				}
-			}
-			else
-			{
 				/*
-				 * Change the state of the down button to enable the program
-				 * to enter the area of condition once again after releasing the button
+				 * Force the cursor to go left or right in the same row
+				 * depending on the value of the position of the cursor
+				 * this value depend on time of clicks on left or right buttons
 				 */
-				Down_flag = TRUE;
+				LCD_GO_TO_ROW_COLUMN(DIGITAL_CLOCK_ROW, getCursorColumn());
 			}
 			/************************************************************************/
 		}
+		/*
+		 * Call the expired software timers which run outside the interrupt
+		 */
+		SoftTimer_dispatch();
+		/*
+		 * Sleep until the next interrupt if there is nothing left to do
+		 */
+		sleepUntilInterrupt(changedDigits);
 	}/*End of super loop*/
 
 	return 0;
@@ -7,11 +7,12 @@
 
 
 #ifndef F_CPU
-#define F_CPU 8000000UL //1MHz Clock frequency
+#define F_CPU 1000000UL //1MHz Clock frequency
 #endif
 
 #include <avr/io.h>
 #include <avr/interrupt.h>
+#include <avr/sleep.h>
 #include <util/delay.h>
 
 #endif /* MICRO_CONFIG_H_ */
@@ -0,0 +1,354 @@
+/**********************************************************************************
+ * [FILE NAME]: soft_timer.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: File of the software timers, many one shot and periodic timers
+ *                multiplexed on one hardware timer tick using a hashed timing wheel
+ ***********************************************************************************/
+#include"soft_timer.h"
+
+/*
+ * Every slot is a doubly linked list so a timer is removed in O(1)
+ */
+static SoftTimer_Type *g_softTimerWheel[SOFT_TIMER_WHEEL_SIZE];
+static uint8 g_softTimerCurrentSlot = 0;
+
+/*
+ * Expired deferred timers waiting for SoftTimer_dispatch, first in first out
+ */
+static SoftTimer_Type * volatile g_softTimerPendingHead = NULL_PTR;
+static SoftTimer_Type *g_softTimerPendingTail = NULL_PTR;
+
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_link
+ *
+ * [Description]:  Function to link the timer in the wheel to expire after a_delay ticks,
+ *                 called with the interrupts disabled
+ *
+ * [Args]:         a_timer, a_delay
+ *
+ * [In]            a_timer: Pointer to the timer
+ *                 a_delay: Ticks until the expiry, not 0
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static void SoftTimer_link(SoftTimer_Type *a_timer, uint16 a_delay)
+{
+	uint8 slot = (uint8)((g_softTimerCurrentSlot + a_delay) & SOFT_TIMER_WHEEL_MASK);
+
+	/*
+	 * The slot is visited again every SOFT_TIMER_WHEEL_SIZE ticks
+	 */
+	a_timer->rounds = (uint16)((a_delay - 1) >> SOFT_TIMER_WHEEL_SHIFT);
+
+	/*
+	 * Link at the head, so a timer restarted while its slot is
+	 * being walked is not visited again in the same tick
+	 */
+	a_timer->previous = NULL_PTR;
+	a_timer->next = g_softTimerWheel[slot];
+	if(g_softTimerWheel[slot] != NULL_PTR)
+	{
+		g_softTimerWheel[slot]->previous = a_timer;
+	}
+	g_softTimerWheel[slot] = a_timer;
+	a_timer->slot = slot;
+	a_timer->running = TRUE;
+}
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_unlink
+ *
+ * [Description]:  Function to remove the timer from its slot of the wheel,
+ *                 called with the interrupts disabled
+ *
+ * [Args]:         a_timer
+ *
+ * [In]            a_timer: Pointer to the timer
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static void SoftTimer_unlink(SoftTimer_Type *a_timer)
+{
+	if(a_timer->running == FALSE)
+	{
+		return;
+	}
+
+	if(a_timer->previous != NULL_PTR)
+	{
+		a_timer->previous->next = a_timer->next;
+	}
+	else
+	{
+		g_softTimerWheel[a_timer->slot] = a_timer->next;
+	}
+	if(a_timer->next != NULL_PTR)
+	{
+		a_timer->next->previous = a_timer->previous;
+	}
+
+	a_timer->next = NULL_PTR;
+	a_timer->previous = NULL_PTR;
+	a_timer->running = FALSE;
+}
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_init
+ *
+ * [Description]:  Function to empty the timing wheel and the deferred list
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_init(void)
+{
+	uint8 slot;
+	uint8 sreg = SREG;
+
+	cli();
+	for(slot = 0; slot < SOFT_TIMER_WHEEL_SIZE; slot++)
+	{
+		g_softTimerWheel[slot] = NULL_PTR;
+	}
+	g_softTimerCurrentSlot = 0;
+	g_softTimerPendingHead = NULL_PTR;
+	g_softTimerPendingTail = NULL_PTR;
+	SREG = sreg;
+}
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_create
+ *
+ * [Description]:  Function to attach the call back function to a software timer
+ *
+ * [Args]:         a_timer, a_ptr, a_context
+ *
+ * [In]            a_timer:   Pointer to the timer, owned by the caller
+ *                 a_ptr:     Call back function called when the timer expires
+ *                 a_context: SoftTimer_ISR --> called inside the tick interrupt
+ *                            SoftTimer_Deferred --> called by SoftTimer_dispatch in the main loop
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_create(SoftTimer_Type *a_timer, void(*a_ptr)(void), SoftTimer_Context a_context)
+{
+	a_timer->next = NULL_PTR;
+	a_timer->previous = NULL_PTR;
+	a_timer->expiredNext = NULL_PTR;
+	a_timer->callBack = a_ptr;
+	a_timer->period = SOFT_TIMER_ONE_SHOT;
+	a_timer->rounds = 0;
+	a_timer->slot = 0;
+	a_timer->context = a_context;
+	a_timer->running = FALSE;
+	a_timer->queued = FALSE;
+	a_timer->pending = FALSE;
+}
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_start
+ *
+ * [Description]:  Function to (re)start a software timer, safe to call from a call back
+ *
+ * [Args]:         a_timer, a_delay, a_period
+ *
+ * [In]            a_timer:  Pointer to the timer
+ *                 a_delay:  Ticks until the first expiry (0 is taken as 1)
+ *                 a_period: Ticks between the next expiries, SOFT_TIMER_ONE_SHOT for one shot
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_start(SoftTimer_Type *a_timer, uint16 a_delay, uint16 a_period)
+{
+	uint8 sreg = SREG;
+
+	if(a_delay == 0)
+	{
+		a_delay = 1;
+	}
+
+	cli();
+	SoftTimer_unlink(a_timer);
+	a_timer->period = a_period;
+	SoftTimer_link(a_timer, a_delay);
+	SREG = sreg;
+}
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_stop
+ *
+ * [Description]:  Function to stop a software timer and drop its deferred call if any
+ *
+ * [Args]:         a_timer
+ *
+ * [In]            a_timer: Pointer to the timer
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_stop(SoftTimer_Type *a_timer)
+{
+	uint8 sreg = SREG;
+
+	cli();
+	SoftTimer_unlink(a_timer);
+	/*
+	 * A waiting deferred call stays in the list, dispatch skips it
+	 */
+	a_timer->pending = FALSE;
+	SREG = sreg;
+}
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_tick
+ *
+ * [Description]:  Function to advance the wheel by one slot, called from the hardware timer
+ *                 interrupt every SOFT_TIMER_TICK_MS
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_tick(void)
+{
+	SoftTimer_Type *timer;
+	SoftTimer_Type *next;
+	SoftTimer_Type *expiredHead = NULL_PTR;
+
+	g_softTimerCurrentSlot = (uint8)((g_softTimerCurrentSlot + 1) & SOFT_TIMER_WHEEL_MASK);
+
+	timer = g_softTimerWheel[g_softTimerCurrentSlot];
+	while(timer != NULL_PTR)
+	{
+		next = timer->next;
+
+		if(timer->rounds != 0)
+		{
+			timer->rounds--;
+		}
+		else
+		{
+			SoftTimer_unlink(timer);
+			if(timer->period != SOFT_TIMER_ONE_SHOT)
+			{
+				SoftTimer_link(timer, timer->period);
+			}
+
+			if(timer->context == SoftTimer_ISR)
+			{
+				/*
+				 * Called after the walk, a call back may start or stop other timers of this slot
+				 */
+				timer->expiredNext = expiredHead;
+				expiredHead = timer;
+			}
+			else
+			{
+				/*
+				 * Still waiting from the last expiry --> the main loop is late,
+				 * the call back is called once only
+				 */
+				timer->pending = TRUE;
+				if(timer->queued == FALSE)
+				{
+					timer->queued = TRUE;
+					timer->expiredNext = NULL_PTR;
+					if(g_softTimerPendingHead == NULL_PTR)
+					{
+						g_softTimerPendingHead = timer;
+					}
+					else
+					{
+						g_softTimerPendingTail->expiredNext = timer;
+					}
+					g_softTimerPendingTail = timer;
+				}
+			}
+		}
+
+		timer = next;
+	}
+
+	while(expiredHead != NULL_PTR)
+	{
+		timer = expiredHead;
+		expiredHead = timer->expiredNext;
+		if(timer->callBack != NULL_PTR)
+		{
+			(*timer->callBack)();
+		}
+	}
+}
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_dispatch
+ *
+ * [Description]:  Function to call the call back functions of the expired deferred timers,
+ *                 called from the main loop
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_dispatch(void)
+{
+	SoftTimer_Type *timer;
+	bool call;
+	uint8 sreg;
+
+	while(g_softTimerPendingHead != NULL_PTR)
+	{
+		/*
+		 * Take one timer off the list, the interrupt appends at the tail
+		 */
+		sreg = SREG;
+		cli();
+		timer = g_softTimerPendingHead;
+		g_softTimerPendingHead = timer->expiredNext;
+		timer->queued = FALSE;
+		call = timer->pending;
+		timer->pending = FALSE;
+		SREG = sreg;
+
+		if((call == TRUE) && (timer->callBack != NULL_PTR))
+		{
+			(*timer->callBack)();
+		}
+	}
+}
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_isPending
+ *
+ * [Description]:  Function to know if any deferred call back waits for SoftTimer_dispatch
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TRUE if a deferred call back is waiting
+ ***************************************************************************************************/
+bool SoftTimer_isPending(void)
+{
+	return (g_softTimerPendingHead != NULL_PTR) ? TRUE : FALSE;
+}
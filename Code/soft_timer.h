@@ -0,0 +1,174 @@
+/**********************************************************************************
+ * [FILE NAME]: soft_timer.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: File of All types Declaration and Functions prototypes of the
+ *                software timers which share one hardware timer tick.
+ *
+ ***********************************************************************************/
+#ifndef SOFT_TIMER_H_
+#define SOFT_TIMER_H_
+
+#include "std_types.h"
+#include "common_macros.h"
+#include "micro_config.h"
+
+/**************************************************************************
+ *                          Preprocessor Macros                           *
+ * ************************************************************************/
+/*
+ * Hashed timing wheel: a timer which expires after N ticks is linked in
+ * the slot (current + N) % SOFT_TIMER_WHEEL_SIZE with N / SOFT_TIMER_WHEEL_SIZE
+ * rounds to wait, so start and stop are O(1) and every tick visits one slot
+ */
+#define SOFT_TIMER_WHEEL_SHIFT                      4
+#define SOFT_TIMER_WHEEL_SIZE                       (1 << SOFT_TIMER_WHEEL_SHIFT)
+#define SOFT_TIMER_WHEEL_MASK                       (SOFT_TIMER_WHEEL_SIZE - 1)
+
+/*
+ * Period of the hardware tick which drives the wheel (Timer0 compare)
+ */
+#define SOFT_TIMER_TICK_MS                          1
+#define SOFT_TIMER_MS_TO_TICKS(MS)                  ((uint16)((MS) / SOFT_TIMER_TICK_MS))
+
+#define SOFT_TIMER_ONE_SHOT                         0
+
+/**************************************************************************
+ *                          Types Declaration                             *
+ * ************************************************************************/
+typedef enum
+{
+	SoftTimer_ISR, SoftTimer_Deferred
+}SoftTimer_Context;
+
+/*
+ * Owned by the caller (static or global), the driver only links it
+ */
+typedef struct SoftTimer_Type
+{
+	struct SoftTimer_Type *next;
+	struct SoftTimer_Type *previous;
+	struct SoftTimer_Type *expiredNext;
+	void (*callBack)(void);
+	uint16 period;
+	uint16 rounds;
+	uint8 slot;
+	SoftTimer_Context context;
+	bool running;
+	bool queued;
+	bool pending;
+}SoftTimer_Type;
+
+/**************************************************************************
+ *                          Functions Prototypes                          *
+ * ************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_init
+ *
+ * [Description]:  Function to empty the timing wheel and the deferred list
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_init(void);
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_create
+ *
+ * [Description]:  Function to attach the call back function to a software timer
+ *
+ * [Args]:         a_timer, a_ptr, a_context
+ *
+ * [In]            a_timer:   Pointer to the timer, owned by the caller
+ *                 a_ptr:     Call back function called when the timer expires
+ *                 a_context: SoftTimer_ISR --> called inside the tick interrupt
+ *                            SoftTimer_Deferred --> called by SoftTimer_dispatch in the main loop
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_create(SoftTimer_Type *a_timer, void(*a_ptr)(void), SoftTimer_Context a_context);
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_start
+ *
+ * [Description]:  Function to (re)start a software timer, safe to call from a call back
+ *
+ * [Args]:         a_timer, a_delay, a_period
+ *
+ * [In]            a_timer:  Pointer to the timer
+ *                 a_delay:  Ticks until the first expiry (0 is taken as 1)
+ *                 a_period: Ticks between the next expiries, SOFT_TIMER_ONE_SHOT for one shot
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_start(SoftTimer_Type *a_timer, uint16 a_delay, uint16 a_period);
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_stop
+ *
+ * [Description]:  Function to stop a software timer and drop its deferred call if any
+ *
+ * [Args]:         a_timer
+ *
+ * [In]            a_timer: Pointer to the timer
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_stop(SoftTimer_Type *a_timer);
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_tick
+ *
+ * [Description]:  Function to advance the wheel by one slot, called from the hardware timer
+ *                 interrupt every SOFT_TIMER_TICK_MS
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_tick(void);
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_dispatch
+ *
+ * [Description]:  Function to call the call back functions of the expired deferred timers,
+ *                 called from the main loop
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void SoftTimer_dispatch(void);
+/***************************************************************************************************
+ * [Function Name]: SoftTimer_isPending
+ *
+ * [Description]:  Function to know if any deferred call back waits for SoftTimer_dispatch
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TRUE if a deferred call back is waiting
+ ***************************************************************************************************/
+bool SoftTimer_isPending(void);
+
+#endif /* SOFT_TIMER_H_ */
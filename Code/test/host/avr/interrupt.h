@@ -0,0 +1,21 @@
+/**********************************************************************************
+ * [FILE NAME]: interrupt.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: Host stand-in of <avr/interrupt.h> for the tests, the tests
+ *                call the ISRs themselves so the global interrupt enable is
+ *                only the I bit of the SREG byte
+ ***********************************************************************************/
+
+#ifndef HOST_AVR_INTERRUPT_H_
+#define HOST_AVR_INTERRUPT_H_
+
+#include <avr/io.h>
+
+#define cli()                       (SREG &= (unsigned char)~(1<<7))
+#define sei()                       (SREG |= (1<<7))
+
+#endif /* HOST_AVR_INTERRUPT_H_ */
@@ -0,0 +1,67 @@
+/**********************************************************************************
+ * [FILE NAME]: io.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: Host stand-in of <avr/io.h> for the tests, the I/O registers
+ *                are bytes of g_hostRegisters at their ATmega32 data addresses
+ ***********************************************************************************/
+
+#ifndef HOST_AVR_IO_H_
+#define HOST_AVR_IO_H_
+
+extern volatile unsigned char g_hostRegisters[256];
+
+#define HOST_REGISTER(ADDRESS)      (g_hostRegisters[ADDRESS])
+
+#define PINA                        HOST_REGISTER(0X39)
+#define DDRA                        HOST_REGISTER(0X3A)
+#define PORTA                       HOST_REGISTER(0X3B)
+#define PINB                        HOST_REGISTER(0X36)
+#define DDRB                        HOST_REGISTER(0X37)
+#define PORTB                       HOST_REGISTER(0X38)
+#define PINC                        HOST_REGISTER(0X33)
+#define DDRC                        HOST_REGISTER(0X34)
+#define PORTC                       HOST_REGISTER(0X35)
+#define PIND                        HOST_REGISTER(0X30)
+#define DDRD                        HOST_REGISTER(0X31)
+#define PORTD                       HOST_REGISTER(0X32)
+#define MCUCR                       HOST_REGISTER(0X55)
+#define SREG                        HOST_REGISTER(0X5F)
+
+#define PA0                         0
+#define PA1                         1
+#define PA2                         2
+#define PB2                         2
+#define PB3                         3
+#define PB5                         5
+#define PB6                         6
+#define PB7                         7
+#define PC7                         7
+#define PD2                         2
+#define PD3                         3
+#define PD4                         4
+#define PD5                         5
+#define PD7                         7
+
+/* Interrupt vectors of the ATmega32 */
+#define INT0_vect                   __vector_1
+#define INT1_vect                   __vector_2
+#define INT2_vect                   __vector_3
+#define TIMER2_COMP_vect            __vector_4
+#define TIMER2_OVF_vect             __vector_5
+#define TIMER1_CAPT_vect            __vector_6
+#define TIMER1_COMPA_vect           __vector_7
+#define TIMER1_COMPB_vect           __vector_8
+#define TIMER1_OVF_vect             __vector_9
+#define TIMER0_COMP_vect            __vector_10
+#define TIMER0_OVF_vect             __vector_11
+
+#define SE                          7
+#define SM0                         4
+#define SM1                         5
+#define SM2                         6
+
+#endif /* HOST_AVR_IO_H_ */
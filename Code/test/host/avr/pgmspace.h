@@ -0,0 +1,19 @@
+/**********************************************************************************
+ * [FILE NAME]: pgmspace.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: Host stand-in of <avr/pgmspace.h> for the tests, the flash
+ *                tables are ordinary constants
+ ***********************************************************************************/
+
+#ifndef HOST_AVR_PGMSPACE_H_
+#define HOST_AVR_PGMSPACE_H_
+
+#define PROGMEM
+#define pgm_read_byte(ADDRESS)      (*(const unsigned char *)(ADDRESS))
+#define pgm_read_word(ADDRESS)      (*(const unsigned short *)(ADDRESS))
+
+#endif /* HOST_AVR_PGMSPACE_H_ */
@@ -0,0 +1,21 @@
+/**********************************************************************************
+ * [FILE NAME]: sleep.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: Host stand-in of <avr/sleep.h> for the tests
+ ***********************************************************************************/
+
+#ifndef HOST_AVR_SLEEP_H_
+#define HOST_AVR_SLEEP_H_
+
+#define SLEEP_MODE_IDLE             0X00
+#define SLEEP_MODE_PWR_SAVE         0X30
+#define set_sleep_mode(MODE)        ((void)(MODE))
+#define sleep_enable()              ((void)0)
+#define sleep_disable()             ((void)0)
+#define sleep_cpu()                 ((void)0)
+
+#endif /* HOST_AVR_SLEEP_H_ */
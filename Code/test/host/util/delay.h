@@ -0,0 +1,17 @@
+/**********************************************************************************
+ * [FILE NAME]: delay.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: Host stand-in of <util/delay.h> for the tests, no delay
+ ***********************************************************************************/
+
+#ifndef HOST_UTIL_DELAY_H_
+#define HOST_UTIL_DELAY_H_
+
+#define _delay_ms(TIME)             ((void)(TIME))
+#define _delay_us(TIME)             ((void)(TIME))
+
+#endif /* HOST_UTIL_DELAY_H_ */
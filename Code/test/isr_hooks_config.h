@@ -0,0 +1,19 @@
+/**********************************************************************************
+ * [FILE NAME]: isr_hooks_config.h
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: ISR hooks of the tests, none, every vector calls its
+ *                subscribers list so the drivers are tested alone
+ ***********************************************************************************/
+
+#ifndef ISR_HOOKS_CONFIG_H_
+#define ISR_HOOKS_CONFIG_H_
+
+#include "std_types.h"
+
+#define ISR_HOOKS                               FALSE
+
+#endif /* ISR_HOOKS_CONFIG_H_ */
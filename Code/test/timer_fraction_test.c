@@ -0,0 +1,106 @@
+/**********************************************************************************
+ * [FILE NAME]: timer_fraction_test.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: Host test of the fractional compare match of Timer1, a month
+ *                of compare match interrupts is run and the time counted by
+ *                the periods must never be one timer count away from the
+ *                wanted time
+ ***********************************************************************************/
+
+#include <stdio.h>
+#include "timer_interface.h"
+
+volatile unsigned char g_hostRegisters[256];
+
+/* Compare match A interrupt of timer.c */
+void TIMER1_COMPA_vect(void);
+
+/* One month of one second ticks */
+#define TEST_TICKS                              (31UL * 24UL * 60UL * 60UL)
+
+/***************************************************************************************************
+ * [Function Name]: Test_fraction
+ *
+ * [Description]:  Function to run TEST_TICKS periods of (base + remainder/denominator) counts
+ *                 and check the counted time after every period
+ *
+ * [Args]:         base, remainder, denominator
+ *
+ * [In]            base: Whole timer counts of the period
+ *                 remainder: Numerator of the fraction of a count
+ *                 denominator: Denominator of the fraction of a count
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Number of failures
+ ***************************************************************************************************/
+static int Test_fraction(uint16 base, uint16 remainder, uint16 denominator)
+{
+	uint64 tick;
+	uint64 counts = 0;
+	uint64 wanted;
+	uint64 error;
+	uint64 worstError = 0;
+
+	Timer1_setFractionalCompare(base, remainder, denominator);
+
+	for(tick = 1; tick <= TEST_TICKS; tick++)
+	{
+		/*
+		 * The period which ends now is OCR1A+1 counts, the interrupt
+		 * then chooses the next one
+		 */
+		counts += (uint64)TIMER1_OUTPUT_COMPARE_REGISTER_A + 1;
+		TIMER1_COMPA_vect();
+
+		/*
+		 * Compare in 1/denominator counts: counts*denominator against
+		 * tick*(base*denominator + remainder)
+		 */
+		wanted = tick * ((uint64)base * denominator + remainder);
+		error = (counts * denominator > wanted) ? (counts * denominator - wanted) : (wanted - counts * denominator);
+		if(error > worstError)
+		{
+			worstError = error;
+		}
+		if(error >= denominator)
+		{
+			printf("FAIL %u+%u/%u: tick %llu is %llu/%u counts away\n",
+					base, remainder, denominator, tick, error, denominator);
+			return 1;
+		}
+	}
+
+	printf("ok   %u+%u/%u: %lu ticks, worst error %llu/%u count\n",
+			base, remainder, denominator, TEST_TICKS, worstError, denominator);
+	return 0;
+}
+
+int main(void)
+{
+	int failures = 0;
+
+	/*
+	 * The clock tick of the application, one second at F_CPU with the
+	 * pre-scaler chosen by the period solver (976+576/1024 at 1MHz)
+	 */
+	failures += Test_fraction(F_CPU / TIMER_PRESCALER_US(TIMER1, 1000000UL),
+			F_CPU % TIMER_PRESCALER_US(TIMER1, 1000000UL), TIMER_PRESCALER_US(TIMER1, 1000000UL));
+
+	/*
+	 * Whole period, smallest and largest fractions, and a denominator
+	 * which is not a power of two
+	 */
+	failures += Test_fraction(976, 0, 1024);
+	failures += Test_fraction(976, 1, 1024);
+	failures += Test_fraction(976, 576, 1024);
+	failures += Test_fraction(976, 1023, 1024);
+	failures += Test_fraction(15625, 2, 3);
+	failures += Test_fraction(2, 65534, 65535);
+
+	return (failures != 0);
+}
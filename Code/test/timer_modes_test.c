@@ -0,0 +1,310 @@
+/**********************************************************************************
+ * [FILE NAME]: timer_modes_test.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: Host test of the table driven Timer0/Timer1/Timer2 init
+ *                functions, every mode, channel, clock and compare output
+ *                mode is run on random register contents through timer.c
+ *                and through the per-mode code it replaced
+ *                (timer_reference.c), the registers written must be the same
+ ***********************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "timer_interface.h"
+#include "common_macros.h"
+
+volatile unsigned char g_hostRegisters[256];
+
+void Reference_Timer0_Init(const Timer0_ConfigType* config_PTR);
+void Reference_Timer1_Init(const Timer1_ConfigType* Timer1_config_PTR);
+void Reference_Timer2_Init(const Timer2_ConfigType* config_PTR);
+
+/* Random register contents tried for every configuration */
+#define TEST_ROUNDS                             8
+
+/* Addresses of the registers the tests look at alone */
+#define TEST_TCNT0                              0X52
+#define TEST_TCNT2                              0X44
+#define TEST_SFIOR                              0X50
+#define TEST_TCCR1A                             0X4F
+
+static uint8 g_initialRegisters[256];
+static uint8 g_referenceRegisters[256];
+static uint8 g_newRegisters[256];
+static unsigned long g_runs = 0;
+
+/***************************************************************************************************
+ * [Function Name]: Test_randomRegisters
+ *
+ * [Description]:  Function to fill the registers with random contents and keep a copy
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static void Test_randomRegisters(void)
+{
+	uint16 i;
+
+	for(i = 0; i < 256; i++)
+	{
+		g_initialRegisters[i] = (uint8)rand();
+		g_hostRegisters[i] = g_initialRegisters[i];
+	}
+}
+/***************************************************************************************************
+ * [Function Name]: Test_saveRegisters
+ *
+ * [Description]:  Function to copy the registers after an init and start the next init from
+ *                 the same random contents
+ *
+ * [Args]:         a_copy
+ *
+ * [In]            NONE
+ *
+ * [Out]           a_copy: The 256 register bytes
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static void Test_saveRegisters(uint8 *a_copy)
+{
+	uint16 i;
+
+	for(i = 0; i < 256; i++)
+	{
+		a_copy[i] = g_hostRegisters[i];
+		g_hostRegisters[i] = g_initialRegisters[i];
+	}
+}
+/***************************************************************************************************
+ * [Function Name]: Test_compare
+ *
+ * [Description]:  Function to compare the registers written by the reference and by timer.c,
+ *                 the register at a_skip (0 for none) is checked by the caller
+ *
+ * [Args]:         a_name, a_mode, a_skip
+ *
+ * [In]            a_name: Name of the timer
+ *                 a_mode: Mode under test
+ *                 a_skip: Address of the register which is not compared
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Number of failures
+ ***************************************************************************************************/
+static int Test_compare(const char *a_name, uint8 a_mode, uint8 a_skip)
+{
+	uint16 i;
+	int failures = 0;
+
+	g_runs++;
+	for(i = 0; i < 256; i++)
+	{
+		if((i != a_skip) && (g_referenceRegisters[i] != g_newRegisters[i]))
+		{
+			printf("FAIL %s mode %u: register 0X%02X is 0X%02X, was 0X%02X\n",
+					a_name, a_mode, i, g_newRegisters[i], g_referenceRegisters[i]);
+			failures++;
+		}
+	}
+	return failures;
+}
+/***************************************************************************************************
+ * [Function Name]: Test_timer0
+ *
+ * [Description]:  Function to test all the configurations of Timer0, the initial value is
+ *                 now written to TCNT0 (it was written to TCCR0 and lost)
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Number of failures
+ ***************************************************************************************************/
+static int Test_timer0(void)
+{
+	Timer0_ConfigType config;
+	uint8 mode, clock, nonPwm, fastPwm, phaseCorrect, round;
+	int failures = 0;
+
+	for(mode = Overflow; mode <= FAST_PWM; mode++)
+	for(clock = NO_CLOCK; clock <= F_CPU_1024; clock++)
+	for(nonPwm = 0; nonPwm < 4; nonPwm++)
+	for(fastPwm = 0; fastPwm < 4; fastPwm++)
+	for(phaseCorrect = 0; phaseCorrect < 4; phaseCorrect++)
+	for(round = 0; round < TEST_ROUNDS; round++)
+	{
+		config.timer0_InitialValue = (uint8)rand();
+		config.timer0_compare_MatchValue = (uint8)rand();
+		config.timer0_clock = clock;
+		config.timer0_mode = mode;
+		config.Compare_Mode_NonPWM = nonPwm;
+		config.Compare_Mode_FASTPWM = fastPwm;
+		config.Compare_Mode_PWM_PhaseCorrect = phaseCorrect;
+
+		Test_randomRegisters();
+		Reference_Timer0_Init(&config);
+		Test_saveRegisters(g_referenceRegisters);
+		Timer0_Init(&config);
+		Test_saveRegisters(g_newRegisters);
+
+		failures += Test_compare("Timer0", mode, TEST_TCNT0);
+		if(g_newRegisters[TEST_TCNT0] != config.timer0_InitialValue)
+		{
+			printf("FAIL Timer0 mode %u: TCNT0 is not the initial value\n", mode);
+			failures++;
+		}
+		if(failures != 0)
+		{
+			return failures;
+		}
+	}
+	return failures;
+}
+/***************************************************************************************************
+ * [Function Name]: Test_timer1
+ *
+ * [Description]:  Function to test all the configurations of Timer1, SFIOR is no longer
+ *                 cleared by the 16-bit TCCR1A access and PWM_PhaseCorrect_ICR1 (mode 10)
+ *                 now sets WGM11 (it was configured as mode 8)
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Number of failures
+ ***************************************************************************************************/
+static int Test_timer1(void)
+{
+	Timer1_ConfigType config;
+	uint8 mode, channel, clock, nonPwm, fastPwm, phaseCorrect, round;
+	int failures = 0;
+
+	for(mode = Normal; mode <= FAST_PWM_OCR1A; mode++)
+	for(channel = ChannelA; channel <= ChannelB; channel++)
+	for(clock = NO_CLOCK; clock <= F_CPU_1024; clock++)
+	for(nonPwm = 0; nonPwm < 4; nonPwm++)
+	for(fastPwm = 0; fastPwm < 4; fastPwm++)
+	for(phaseCorrect = 0; phaseCorrect < 4; phaseCorrect++)
+	for(round = 0; round < TEST_ROUNDS; round++)
+	{
+		config.timer1_InitialValue = (uint16)rand();
+		config.timer1_compare_MatchValue = (uint16)rand();
+		config.timer1_InputCaptureValue = (uint16)rand();
+		config.timer1_clock = clock;
+		config.timer1_mode = mode;
+		config.channel = channel;
+		config.Compare_Mode_NonPWM = nonPwm;
+		config.Compare_Mode_FASTPWM = fastPwm;
+		config.Compare_Mode_PWM_PhaseCorrect = phaseCorrect;
+
+		Test_randomRegisters();
+		Reference_Timer1_Init(&config);
+		Test_saveRegisters(g_referenceRegisters);
+		Timer1_Init(&config);
+		Test_saveRegisters(g_newRegisters);
+
+		if(mode == PWM_PhaseCorrect_ICR1)
+		{
+			if(BIT_IS_CLEAR(g_newRegisters[TEST_TCCR1A], WGM11_BIT))
+			{
+				printf("FAIL Timer1 mode %u: WGM11 is not set\n", mode);
+				failures++;
+			}
+			CLEAR_BIT(g_newRegisters[TEST_TCCR1A], WGM11_BIT);
+		}
+
+		failures += Test_compare("Timer1", mode, TEST_SFIOR);
+		if(g_newRegisters[TEST_SFIOR] != g_initialRegisters[TEST_SFIOR])
+		{
+			printf("FAIL Timer1 mode %u: SFIOR is written\n", mode);
+			failures++;
+		}
+		if(failures != 0)
+		{
+			return failures;
+		}
+	}
+	return failures;
+}
+/***************************************************************************************************
+ * [Function Name]: Test_timer2
+ *
+ * [Description]:  Function to test all the configurations of Timer2, the initial value is
+ *                 now written to TCNT2 (it was written to TCCR2 and lost)
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Number of failures
+ ***************************************************************************************************/
+static int Test_timer2(void)
+{
+	Timer2_ConfigType config;
+	uint8 mode, clock, nonPwm, fastPwm, phaseCorrect, round;
+	int failures = 0;
+
+	for(mode = Overflow; mode <= FAST_PWM; mode++)
+	for(clock = T2_NO_CLOCK; clock <= T2_F_CPU_1024; clock++)
+	for(nonPwm = 0; nonPwm < 4; nonPwm++)
+	for(fastPwm = 0; fastPwm < 4; fastPwm++)
+	for(phaseCorrect = 0; phaseCorrect < 4; phaseCorrect++)
+	for(round = 0; round < TEST_ROUNDS; round++)
+	{
+		config.timer2_InitialValue = (uint8)rand();
+		config.timer2_compare_MatchValue = (uint8)rand();
+		config.timer2_clock = clock;
+		config.timer2_mode = mode;
+		config.Compare_Mode_NonPWM = nonPwm;
+		config.Compare_Mode_FASTPWM = fastPwm;
+		config.Compare_Mode_PWM_PhaseCorrect = phaseCorrect;
+
+		Test_randomRegisters();
+		Reference_Timer2_Init(&config);
+		Test_saveRegisters(g_referenceRegisters);
+		Timer2_Init(&config);
+		Test_saveRegisters(g_newRegisters);
+
+		failures += Test_compare("Timer2", mode, TEST_TCNT2);
+		if(g_newRegisters[TEST_TCNT2] != config.timer2_InitialValue)
+		{
+			printf("FAIL Timer2 mode %u: TCNT2 is not the initial value\n", mode);
+			failures++;
+		}
+		if(failures != 0)
+		{
+			return failures;
+		}
+	}
+	return failures;
+}
+
+int main(void)
+{
+	int failures = 0;
+
+	srand(1);
+	failures += Test_timer0();
+	failures += Test_timer1();
+	failures += Test_timer2();
+
+	printf("%s  %lu configurations, registers of timer.c %s the reference\n",
+			(failures == 0) ? "ok" : "FAIL", g_runs, (failures == 0) ? "match" : "do not match");
+
+	return (failures != 0);
+}
@@ -0,0 +1,152 @@
+/**********************************************************************************
+ * [FILE NAME]: timer_timestamp_test.c
+ *
+ * [AUTHOR]: Toka Zakaria Mohamed Ramadan
+ *
+ * [DATE CREATED]: Oct 17, 2021
+ *
+ * [Description]: Host test of the Timer1 milli seconds timestamp, the period
+ *                interrupts are run past the wrap of the 32-bit count of
+ *                Timer1 and Timer1_getMillis must go on counting
+ ***********************************************************************************/
+
+#include <stdio.h>
+#include "timer_interface.h"
+
+volatile unsigned char g_hostRegisters[256];
+
+/* Compare match A and overflow interrupts of timer.c */
+void TIMER1_COMPA_vect(void);
+void TIMER1_OVF_vect(void);
+
+/* TIFR, its flags are cleared by writing one so the test clears it by hand */
+#define TEST_TIFR                               0X58
+/* TCNT1 low and high bytes */
+#define TEST_TCNT1L                             0X4C
+#define TEST_TCNT1H                             0X4D
+
+/***************************************************************************************************
+ * [Function Name]: Test_setCounter
+ *
+ * [Description]:  Function to set TCNT1 with no interrupt pending
+ *
+ * [Args]:         a_counts
+ *
+ * [In]            a_counts: Value of TCNT1
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static void Test_setCounter(uint16 a_counts)
+{
+	g_hostRegisters[TEST_TCNT1L] = (uint8)a_counts;
+	g_hostRegisters[TEST_TCNT1H] = (uint8)(a_counts >> 8);
+	g_hostRegisters[TEST_TIFR] = 0;
+}
+/***************************************************************************************************
+ * [Function Name]: Test_compareA
+ *
+ * [Description]:  Function to run the clock tick of the application (CTC_OCR1A, F_CPU/64,
+ *                 15625 counts = 1 second) for 5 days, past the wrap of the count after
+ *                 ~3.18 days, and check the milli seconds every second and in the middle
+ *                 of every second
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Number of failures
+ ***************************************************************************************************/
+static int Test_compareA(void)
+{
+	Timer1_ConfigType config = {0, 15624, 0, F_CPU_64, CTC_OCR1A, ChannelA,
+			Disconnected_NonPWM_16, Disconnected_FASTPWM_16, Disconnected_PWMPhaseCorrect_16};
+	uint32 second;
+	uint32 millis;
+	bool wrapped = FALSE;
+
+	Timer1_Init(&config);
+
+	for(second = 1; second <= 5UL * 24UL * 60UL * 60UL; second++)
+	{
+		/*
+		 * Half a second, 7812 counts = 499.968ms
+		 */
+		Test_setCounter(7812);
+		millis = Timer1_getMillis();
+		if(millis != (second - 1) * 1000UL + 499)
+		{
+			printf("FAIL CTC_OCR1A: %lu.5s read as %lums\n", (unsigned long)(second - 1), (unsigned long)millis);
+			return 1;
+		}
+
+		TIMER1_COMPA_vect();
+		Test_setCounter(0);
+		millis = Timer1_getMillis();
+		if(millis != second * 1000UL)
+		{
+			printf("FAIL CTC_OCR1A: %lus read as %lums\n", (unsigned long)second, (unsigned long)millis);
+			return 1;
+		}
+		if(Timer1_getCounts() < 15625UL)
+		{
+			wrapped = TRUE;
+		}
+	}
+
+	printf("ok   CTC_OCR1A: %lu seconds, count of Timer1 %s\n", (unsigned long)(second - 1),
+			(wrapped == TRUE) ? "wrapped" : "did not wrap");
+	return (wrapped == TRUE) ? 0 : 1;
+}
+/***************************************************************************************************
+ * [Function Name]: Test_overflow
+ *
+ * [Description]:  Function to run Timer1 in Normal mode with F_CPU/8 (65536 counts = 524.288ms)
+ *                 past the wrap of the count after 65536 overflows, and check the milli seconds
+ *                 after every overflow
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Number of failures
+ ***************************************************************************************************/
+static int Test_overflow(void)
+{
+	Timer1_ConfigType config = {0, 0, 0, F_CPU_8, Normal, ChannelA,
+			Disconnected_NonPWM_16, Disconnected_FASTPWM_16, Disconnected_PWMPhaseCorrect_16};
+	uint32 overflow;
+	uint32 millis;
+
+	Timer1_Init(&config);
+
+	for(overflow = 1; overflow <= 70000UL; overflow++)
+	{
+		TIMER1_OVF_vect();
+		Test_setCounter(0);
+		millis = Timer1_getMillis();
+		if(millis != (uint32)(((uint64)overflow * 524288ULL) / 1000ULL))
+		{
+			printf("FAIL Normal: overflow %lu read as %lums\n", (unsigned long)overflow, (unsigned long)millis);
+			return 1;
+		}
+	}
+
+	printf("ok   Normal: %lu overflows\n", (unsigned long)(overflow - 1));
+	return 0;
+}
+
+int main(void)
+{
+	int failures = 0;
+
+	failures += Test_compareA();
+	failures += Test_overflow();
+
+	return (failures != 0);
+}
@@ -9,11 +9,106 @@
  ***********************************************************************************/
 #include"timer_interface.h"
 #include"common_macros.h"
+#include"isr_hooks.h"
+
+#include<avr/pgmspace.h>
+
+/* Subscribers of every timer interrupt vector, indexed by Timer_VectorID */
+static IsrDispatch_ListType g_Timer_subscribers[TIMER_VECTORS];
+
+/*
+ * Fractional compare match of Timer1 channel A, the wanted period is
+ * (base + remainder/denominator) counts so every period is base or base+1
+ * counts and the accumulator carries the fraction, denominator 0 = disabled
+ */
+static volatile uint16 g_Timer1_fractionBase = 0;
+static volatile uint16 g_Timer1_fractionRemainder = 0;
+static volatile uint16 g_Timer1_fractionDenominator = 0;
+static volatile uint16 g_Timer1_fractionAccumulator = 0;
+
+/*
+ * Timer counts of all the Timer1 periods completed since Timer1_Init,
+ * extended in the overflow (Normal) or compare match A (CTC_OCR1A) interrupt,
+ * the timestamp is this value + TCNT1, 32-bit so the interrupt adds no 64-bit value
+ */
+static volatile uint32 g_Timer1_elapsedCounts = 0;
+static volatile uint8 g_Timer1_timestampSource = TIMESTAMP_NONE;
+/*
+ * Micro seconds and milli seconds per timer count as reduced fractions
+ * (prescaler*10^6 / F_CPU and prescaler*10^3 / F_CPU)
+ */
+static uint32 g_Timer1_usNumerator = 0;
+static uint32 g_Timer1_usDenominator = 1;
+static uint32 g_Timer1_msNumerator = 0;
+static uint32 g_Timer1_msDenominator = 1;
+/*
+ * Milli seconds of the completed periods, the counts not taken in it yet are
+ * kept in g_Timer1_millisCounts and moved one chunk at a time (chunk counts =
+ * whole milli seconds, at least one full period), so the interrupt never
+ * divides and Timer1_getMillis only wraps when the milli seconds wrap
+ */
+static volatile uint32 g_Timer1_elapsedMillis = 0;
+static volatile uint32 g_Timer1_millisCounts = 0;
+static uint32 g_Timer1_millisChunkCounts = (uint32)TIMER1_MAXIMUM_COUNTS;
+static uint32 g_Timer1_millisChunkMillis = 0;
+
+/*
+ * Add the counts of a completed period to the timestamp, a macro so the
+ * interrupts call no function, COUNTS is at most one full period
+ */
+#define TIMER1_ADD_ELAPSED_COUNTS(COUNTS) \
+	do \
+	{ \
+		uint32 periodCounts = (COUNTS); \
+		g_Timer1_elapsedCounts += periodCounts; \
+		g_Timer1_millisCounts += periodCounts; \
+		if(g_Timer1_millisCounts >= g_Timer1_millisChunkCounts) \
+		{ \
+			g_Timer1_millisCounts -= g_Timer1_millisChunkCounts; \
+			g_Timer1_elapsedMillis += g_Timer1_millisChunkMillis; \
+		} \
+	}while(0)
+
+/*
+ * Mode descriptors in flash, indexed by Timer_8BIT_Mode for Timer0/Timer2
+ * and by Timer_16BIT_Mode for Timer1
+ */
+static const uint8 g_Timer_8bitModes[] PROGMEM =
+{
+	/*Overflow*/         MODE_OUTPUT_NON_PWM | MODE_OVERFLOW_INTERRUPT,
+	/*PWM_PhaseCorrect*/ MODE_OUTPUT_PHASE_CORRECT | MODE_COMPARE_VALUE,
+	/*CTC*/              MODE_OUTPUT_NON_PWM | MODE_COMPARE_VALUE | MODE_COMPARE_INTERRUPT,
+	/*FAST_PWM*/         MODE_OUTPUT_FAST_PWM | MODE_COMPARE_VALUE
+};
 
-/* Global variables to hold the address of the call back function in the application */
-static volatile void (*g_Timer0_callBackPtr)(void) = NULL_PTR;
-static volatile void (*g_Timer1_callBackPtr)(void) = NULL_PTR;
-static volatile void (*g_Timer2_callBackPtr)(void) = NULL_PTR;
+static const uint8 g_Timer1_modes[] PROGMEM =
+{
+	/*Normal*/                           MODE_OUTPUT_NON_PWM | MODE_OVERFLOW_INTERRUPT,
+	/*PWM_PhaseCorrect_8bit*/            MODE_OUTPUT_PHASE_CORRECT | MODE_COMPARE_VALUE,
+	/*PWM_PhaseCorrect_9bit*/            MODE_OUTPUT_PHASE_CORRECT | MODE_COMPARE_VALUE,
+	/*PWM_PhaseCorrect_10bit*/           MODE_OUTPUT_PHASE_CORRECT | MODE_COMPARE_VALUE,
+	/*CTC_OCR1A*/                        MODE_OUTPUT_NON_PWM | MODE_COMPARE_VALUE | MODE_COMPARE_INTERRUPT,
+	/*FAST_PWM_8bit*/                    MODE_OUTPUT_FAST_PWM | MODE_COMPARE_VALUE,
+	/*FAST_PWM_9bit*/                    MODE_OUTPUT_FAST_PWM | MODE_COMPARE_VALUE,
+	/*FAST_PWM_10bit*/                   MODE_OUTPUT_FAST_PWM | MODE_COMPARE_VALUE,
+	/*PWM_Phase_FrequencyCorrect_ICR1*/  MODE_OUTPUT_PHASE_CORRECT | MODE_COMPARE_VALUE | MODE_INPUT_CAPTURE_TOP,
+	/*PWM_Phase_FrequencyCorrect_OCR1A*/ MODE_OUTPUT_PHASE_CORRECT | MODE_COMPARE_VALUE,
+	/*PWM_PhaseCorrect_ICR1*/            MODE_OUTPUT_PHASE_CORRECT | MODE_COMPARE_VALUE | MODE_INPUT_CAPTURE_TOP,
+	/*PWM_PhaseCorrect_OCR1A*/           MODE_OUTPUT_PHASE_CORRECT | MODE_COMPARE_VALUE,
+	/*CTC_ICR1*/                         MODE_OUTPUT_NON_PWM | MODE_COMPARE_VALUE | MODE_COMPARE_INTERRUPT | MODE_INPUT_CAPTURE_TOP,
+	/*Reserved_Mode*/                    MODE_RESERVED,
+	/*FAST_PWM_ICR1*/                    MODE_OUTPUT_FAST_PWM | MODE_COMPARE_VALUE | MODE_INPUT_CAPTURE_TOP,
+	/*FAST_PWM_OCR1A*/                   MODE_OUTPUT_FAST_PWM | MODE_COMPARE_VALUE
+};
+
+/*
+ * Pre-scalers in flash for the timestamp and the period solver, the
+ * index + 1 is the clock select value (Timer_Clock / Timer2_Clock)
+ */
+static const uint16 g_Timer_prescalers[] PROGMEM = {1, 8, 64, 256, 1024};
+#if (TIMER_RUNTIME_SOLVER == TRUE)
+static const uint16 g_Timer2_prescalers[] PROGMEM = {1, 8, 32, 64, 128, 256, 1024};
+#endif
 
 
 /**************************************************************************
@@ -21,63 +116,122 @@ static volatile void (*g_Timer2_callBackPtr)(void) = NULL_PTR;
  * ************************************************************************/
 ISR(TIMER0_OVF_vect)
 {
-	if(g_Timer0_callBackPtr != NULL_PTR)
-	{
-		/* Call the Call Back function in the application after the edge is detected */
-		(*g_Timer0_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
-	}
-
-	/* Clear the flag of timer0 over flow Interrupt*/
-	TIMER0_INTERRUPT_FLAG_REGISTER = SET_BIT(TIMER0_INTERRUPT_FLAG_REGISTER, TIMER0_OVERFLOW_FLAG);
+#ifdef TIMER0_OVF_HOOK
+	/* Handler bound at compile time (isr_hooks.h) */
+	TIMER0_OVF_HOOK();
+#else
+	/* Call the subscribers of the vector */
+	ISR_DISPATCH_RUN(g_Timer_subscribers[Timer0_OVF_Vector]);
+#endif
+
+	/* Clear the flag (written alone so the other pending flags are kept) of timer0 over flow Interrupt*/
+	TIMER0_INTERRUPT_FLAG_REGISTER = (1<<TIMER0_OVERFLOW_FLAG);
 }
 
 ISR(TIMER0_COMP_vect)
 {
-	if(g_Timer0_callBackPtr != NULL_PTR)
-	{
-		/* Call the Call Back function in the application after the edge is detected */
-		(*g_Timer0_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
-	}
-	/* Clear the flag of timer0 compare Interrupt*/
-	TIMER0_INTERRUPT_FLAG_REGISTER = SET_BIT(TIMER0_INTERRUPT_FLAG_REGISTER, TIMER0_COMPARE_FLAG);
+#ifdef TIMER0_COMP_HOOK
+	/* Handler bound at compile time (isr_hooks.h) */
+	TIMER0_COMP_HOOK();
+#else
+	/* Call the subscribers of the vector */
+	ISR_DISPATCH_RUN(g_Timer_subscribers[Timer0_COMP_Vector]);
+#endif
+	/* Clear the flag (written alone so the other pending flags are kept) of timer0 compare Interrupt*/
+	TIMER0_INTERRUPT_FLAG_REGISTER = (1<<TIMER0_COMPARE_FLAG);
 }
 /**************************************************************************
  *                  Timer1_Interrupt_Service_Routines                     *
  * ************************************************************************/
 ISR(TIMER1_OVF_vect)
 {
-	if(g_Timer1_callBackPtr != NULL_PTR)
+	if(g_Timer1_timestampSource == TIMESTAMP_OVERFLOW)
 	{
-		/* Call the Call Back function in the application after the edge is detected */
-		(*g_Timer1_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
+		TIMER1_ADD_ELAPSED_COUNTS((uint32)TIMER1_MAXIMUM_COUNTS);
 	}
 
-	/* Clear the flag of timer1 over flow Interrupt*/
-	TIMER1_INTERRUPT_FLAG_REGISTER = SET_BIT(TIMER1_INTERRUPT_FLAG_REGISTER, TIMER1_OVERFLOW_FLAG);
+#ifdef TIMER1_OVF_HOOK
+	/* Handler bound at compile time (isr_hooks.h) */
+	TIMER1_OVF_HOOK();
+#else
+	/* Call the subscribers of the vector */
+	ISR_DISPATCH_RUN(g_Timer_subscribers[Timer1_OVF_Vector]);
+#endif
+
+	/* Clear the flag (written alone so the other pending flags are kept) of timer1 over flow Interrupt*/
+	TIMER1_INTERRUPT_FLAG_REGISTER = (1<<TIMER1_OVERFLOW_FLAG);
 
 }
 
 ISR(TIMER1_COMPA_vect)
 {
-	if(g_Timer1_callBackPtr != NULL_PTR)
+	if(g_Timer1_timestampSource == TIMESTAMP_COMPARE_A)
 	{
-		/* Call the Call Back function in the application after the edge is detected */
-		(*g_Timer1_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
+		/*
+		 * OCR1A still holds the TOP of the period which just ended
+		 */
+		TIMER1_ADD_ELAPSED_COUNTS((uint32)TIMER1_OUTPUT_COMPARE_REGISTER_A + 1);
+	}
+
+	if(g_Timer1_fractionDenominator != 0)
+	{
+		/*
+		 * Choose the length of the period which just started, TCNT1 has
+		 * just been cleared so OCR1A can still be moved safely
+		 */
+		/*
+		 * accumulator + remainder >= denominator, written so that
+		 * the sum never overflows 16 bits
+		 */
+		if(g_Timer1_fractionAccumulator >= (uint16)(g_Timer1_fractionDenominator - g_Timer1_fractionRemainder))
+		{
+			g_Timer1_fractionAccumulator -= (uint16)(g_Timer1_fractionDenominator - g_Timer1_fractionRemainder);
+			TIMER1_OUTPUT_COMPARE_REGISTER_A = g_Timer1_fractionBase; /* base+1 counts */
+		}
+		else
+		{
+			g_Timer1_fractionAccumulator += g_Timer1_fractionRemainder;
+			TIMER1_OUTPUT_COMPARE_REGISTER_A = g_Timer1_fractionBase - 1; /* base counts */
+		}
 	}
-	/* Clear the flag of timer1 compare Interrupt for channelA*/
-	TIMER1_INTERRUPT_FLAG_REGISTER = SET_BIT(TIMER1_INTERRUPT_FLAG_REGISTER, TIMER1_OUTPUT_COMPARE_A_MATCH_FLAG);
+
+#ifdef TIMER1_COMPA_HOOK
+	/* Handler bound at compile time (isr_hooks.h) */
+	TIMER1_COMPA_HOOK();
+#else
+	/* Call the subscribers of the vector */
+	ISR_DISPATCH_RUN(g_Timer_subscribers[Timer1_COMPA_Vector]);
+#endif
+	/* Clear the flag (written alone so the other pending flags are kept) of timer1 compare Interrupt for channelA*/
+	TIMER1_INTERRUPT_FLAG_REGISTER = (1<<TIMER1_OUTPUT_COMPARE_A_MATCH_FLAG);
 }
 
 ISR(TIMER1_COMPB_vect)
 {
-	if(g_Timer1_callBackPtr != NULL_PTR)
-	{
-		/* Call the Call Back function in the application after the edge is detected */
-		(*g_Timer1_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
-	}
-	/* Clear the flag of timer1 compare Interrupt for channelB*/
-	TIMER1_INTERRUPT_FLAG_REGISTER = SET_BIT(TIMER1_INTERRUPT_FLAG_REGISTER, TIMER1_OUTPUT_COMPARE_B_MATCH_FLAG);
+#ifdef TIMER1_COMPB_HOOK
+	/* Handler bound at compile time (isr_hooks.h) */
+	TIMER1_COMPB_HOOK();
+#else
+	/* Call the subscribers of the vector */
+	ISR_DISPATCH_RUN(g_Timer_subscribers[Timer1_COMPB_Vector]);
+#endif
+	/* Clear the flag (written alone so the other pending flags are kept) of timer1 compare Interrupt for channelB*/
+	TIMER1_INTERRUPT_FLAG_REGISTER = (1<<TIMER1_OUTPUT_COMPARE_B_MATCH_FLAG);
+
+}
 
+ISR(TIMER1_CAPT_vect)
+{
+#ifdef TIMER1_CAPT_HOOK
+	/* Handler bound at compile time (isr_hooks.h) */
+	TIMER1_CAPT_HOOK();
+#else
+	/* Call the subscribers of the vector */
+	ISR_DISPATCH_RUN(g_Timer_subscribers[Timer1_CAPT_Vector]);
+#endif
+
+	/* Clear the flag (written alone so the other pending flags are kept) of timer1 input capture Interrupt*/
+	TIMER1_INTERRUPT_FLAG_REGISTER = (1<<TIMER1_INPUT_CAPTURE_FLAG);
 }
 
 /**************************************************************************
@@ -85,29 +239,207 @@ ISR(TIMER1_COMPB_vect)
  * ************************************************************************/
 ISR(TIMER2_OVF_vect)
 {
-	if(g_Timer2_callBackPtr != NULL_PTR)
+#ifdef TIMER2_OVF_HOOK
+	/* Handler bound at compile time (isr_hooks.h) */
+	TIMER2_OVF_HOOK();
+#else
+	/* Call the subscribers of the vector */
+	ISR_DISPATCH_RUN(g_Timer_subscribers[Timer2_OVF_Vector]);
+#endif
+
+	/* Clear the flag (written alone so the other pending flags are kept) of timer0 over flow Interrupt*/
+	TIMER2_INTERRUPT_FLAG_REGISTER = (1<<TIMER2_OVERFLOW_FLAG);
+}
+
+ISR(TIMER2_COMP_vect)
+{
+#ifdef TIMER2_COMP_HOOK
+	/* Handler bound at compile time (isr_hooks.h) */
+	TIMER2_COMP_HOOK();
+#else
+	/* Call the subscribers of the vector */
+	ISR_DISPATCH_RUN(g_Timer_subscribers[Timer2_COMP_Vector]);
+#endif
+	/* Clear the flag (written alone so the other pending flags are kept) of timer0 compare Interrupt*/
+	TIMER2_INTERRUPT_FLAG_REGISTER = (1<<TIMER2_COMPARE_FLAG);
+}
+/******************************************************************************/
+
+
+/**************************************************************************
+ *                         Mode Descriptors Helpers                       *
+ * ************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: Timer_selectCompareMode
+ *
+ * [Description]:  Function to pick the compare output mode of the configuration which
+ *                 belongs to the family of the timer mode (non-PWM, phase correct, fast PWM)
+ *
+ * [Args]:         descriptor, nonPWM, phaseCorrect, fastPWM
+ *
+ * [In]            descriptor:   Flash descriptor of the timer mode
+ *                 nonPWM:       Compare output mode of the configuration for non-PWM modes
+ *                 phaseCorrect: Compare output mode of the configuration for phase correct modes
+ *                 fastPWM:      Compare output mode of the configuration for fast PWM modes
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      COMx1:0 value of the mode
+ ***************************************************************************************************/
+static uint8 Timer_selectCompareMode(uint8 descriptor, uint8 nonPWM, uint8 phaseCorrect, uint8 fastPWM)
+{
+	switch(descriptor & MODE_OUTPUT_MASK)
 	{
-		/* Call the Call Back function in the application after the edge is detected */
-		(*g_Timer2_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
+	case MODE_OUTPUT_PHASE_CORRECT:
+		return phaseCorrect;
+	case MODE_OUTPUT_FAST_PWM:
+		return fastPWM;
+	default:
+		return nonPWM;
 	}
-
-	/* Clear the flag of timer0 over flow Interrupt*/
-	TIMER2_INTERRUPT_FLAG_REGISTER = SET_BIT(TIMER2_INTERRUPT_FLAG_REGISTER, TIMER2_OVERFLOW_FLAG);
 }
+/***************************************************************************************************
+ * [Function Name]: Timer_8bitControlValue
+ *
+ * [Description]:  Function to build TCCR0/TCCR2 (same layout) without the clock bits:
+ *                 waveform bits from the mode number, compare output mode and FOC
+ *                 for the non-PWM modes
+ *
+ * [Args]:         mode, descriptor, compareMode
+ *
+ * [In]            mode:        Timer_8BIT_Mode of the configuration
+ *                 descriptor:  Flash descriptor of the timer mode
+ *                 compareMode: COMx1:0 value of the mode
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Value of the control register without the clock
+ ***************************************************************************************************/
+static uint8 Timer_8bitControlValue(uint8 mode, uint8 descriptor, uint8 compareMode)
+{
+	uint8 control = (uint8)(compareMode << COM0_SHIFT_VALUE);
 
-ISR(TIMER2_COMP_vect)
+	if(mode & WGM_8BIT_BIT0_MASK)
+	{
+		control |= (1<<WGM00_BIT);
+	}
+	if(mode & WGM_8BIT_BIT1_MASK)
+	{
+		control |= (1<<WGM01_BIT);
+	}
+	if((descriptor & MODE_OUTPUT_MASK) == MODE_OUTPUT_NON_PWM)
+	{
+		control |= (1<<FOC0_BIT);
+	}
+
+	return control;
+}
+/***************************************************************************************************
+ * [Function Name]: Timer_reduceFraction
+ *
+ * [Description]:  Function to divide the two terms of a fraction by their greatest common divisor
+ *
+ * [Args]:         numerator_PTR, denominator_PTR
+ *
+ * [In]            numerator_PTR: Pointer to the numerator
+ *                 denominator_PTR: Pointer to the denominator, not 0
+ *
+ * [Out]           numerator_PTR, denominator_PTR: The reduced terms
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static void Timer_reduceFraction(uint32 *numerator_PTR, uint32 *denominator_PTR)
 {
-	if(g_Timer2_callBackPtr != NULL_PTR)
+	uint32 a = *numerator_PTR;
+	uint32 b = *denominator_PTR;
+	uint32 r;
+
+	while(b != 0)
 	{
-		/* Call the Call Back function in the application after the edge is detected */
-		(*g_Timer2_callBackPtr)(); /* another method to call the function using pointer to function g_callBackPtr(); */
+		r = a % b;
+		a = b;
+		b = r;
 	}
-	/* Clear the flag of timer0 compare Interrupt*/
-	TIMER2_INTERRUPT_FLAG_REGISTER = SET_BIT(TIMER2_INTERRUPT_FLAG_REGISTER, TIMER2_COMPARE_FLAG);
+
+	*numerator_PTR /= a;
+	*denominator_PTR /= a;
 }
-/******************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: Timer1_setTimestampScale
+ *
+ * [Description]:  Function to calculate the micro and milli seconds per Timer1 count of a clock
+ *                 as reduced fractions, so the common cases (1 count = 8us, 64us...) need
+ *                 no division when the timestamp is read
+ *
+ * [Args]:         timer1_clock
+ *
+ * [In]            timer1_clock: Clock of Timer1
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+static void Timer1_setTimestampScale(Timer_Clock timer1_clock)
+{
+	uint32 prescaler;
+	uint32 chunks;
+
+	if((timer1_clock == NO_CLOCK) || (timer1_clock > F_CPU_1024))
+	{
+		/*
+		 * External clock or stopped, keep the last scale
+		 */
+		return;
+	}
+
+	prescaler = pgm_read_word(&g_Timer_prescalers[timer1_clock - 1]);
+
+	g_Timer1_usNumerator = prescaler * 1000000UL;
+	g_Timer1_usDenominator = F_CPU;
+	Timer_reduceFraction(&g_Timer1_usNumerator, &g_Timer1_usDenominator);
+
+	g_Timer1_msNumerator = prescaler * 1000UL;
+	g_Timer1_msDenominator = F_CPU;
+	Timer_reduceFraction(&g_Timer1_msNumerator, &g_Timer1_msDenominator);
 
+	/*
+	 * msDenominator counts are msNumerator milli seconds exactly, take the
+	 * smallest multiple of them which holds a full period of Timer1
+	 * (at 1MHz with F_CPU/64: 525 * 125 = 65625 counts = 4200ms)
+	 */
+	chunks = ((uint32)TIMER1_MAXIMUM_COUNTS + g_Timer1_msDenominator - 1) / g_Timer1_msDenominator;
+	g_Timer1_millisChunkCounts = chunks * g_Timer1_msDenominator;
+	g_Timer1_millisChunkMillis = chunks * g_Timer1_msNumerator;
+}
+/***************************************************************************************************
+ * [Function Name]: Timer1_scaleCounts
+ *
+ * [Description]:  Function to multiply Timer1 counts by a reduced fraction in 32-bit, the counts
+ *                 are split in whole denominators and the rest so the product of the rest is
+ *                 smaller than numerator * denominator and does not overflow
+ *
+ * [Args]:         counts, numerator, denominator
+ *
+ * [In]            counts: Timer1 counts
+ *                 numerator: Numerator of the time of one count
+ *                 denominator: Denominator of the time of one count
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      counts * numerator / denominator, modulo 2^32
+ ***************************************************************************************************/
+static uint32 Timer1_scaleCounts(uint32 counts, uint32 numerator, uint32 denominator)
+{
+	if(denominator == 1)
+	{
+		/*
+		 * One count is a whole number of units, no division
+		 */
+		return counts * numerator;
+	}
 
+	return ((counts / denominator) * numerator) + (((counts % denominator) * numerator) / denominator);
+}
 /**************************************************************************
  *                              Timer0                                    *
  * ************************************************************************/
@@ -132,190 +464,52 @@ ISR(TIMER2_COMP_vect)
  ***************************************************************************************************/
 void Timer0_Init(const Timer0_ConfigType* config_PTR)
 {
+	uint8 mode = (uint8)(config_PTR->timer0_mode);
+	uint8 descriptor = pgm_read_byte(&g_Timer_8bitModes[mode]);
+	uint8 compareMode = Timer_selectCompareMode(descriptor, config_PTR->Compare_Mode_NonPWM,
+			config_PTR->Compare_Mode_PWM_PhaseCorrect, config_PTR->Compare_Mode_FASTPWM);
 
 	/*
 	 * Configure initial value for Timer0 to start count from it
-	 * Anding with 0XFF to make sure the value won't exceed
-	 * 255 as it is 8-bit Timer
 	 */
-
-	TIMER0_CONTROL_REGIRSTER = ( (config_PTR->timer0_InitialValue) ) & 0XFF;
+	TIMER0_INITIAL_VALUE_REGISTER = config_PTR->timer0_InitialValue;
 
 	/*
-	 * Configure Clock Pre-scaler value for Timer0 in TCCR0 Register
-	 * Anding with 0XF8 to make sure the first 3-bits in TCCR0 register=0
-	 * ORing with the selected timer clock to include it in the first 3-bits
-	 * and keep the other bits as they are
+	 * Configure Compare match value for Timer0 before the clock starts
 	 */
-
-	TIMER0_CONTROL_REGIRSTER = (TIMER0_CONTROL_REGIRSTER  & TIMER0_CLOCK_MASK_CLEAR) |
-			(config_PTR->timer0_clock);
-
-
-	switch ( (config_PTR->timer0_mode) )
+	if(descriptor & MODE_COMPARE_VALUE)
 	{
+		TIMER0_OUTPUT_COMPARE_REGISTER = config_PTR->timer0_compare_MatchValue;
+	}
 
-	case Overflow:
-
-		/*
-		 * Configure wave form generation mode to work with normal mode
-		 * Clear WGM00 bit in TCCR0 register
-		 * Clear WGM01 bit in TCCR0 register
-		 */
-		TIMER0_CONTROL_REGIRSTER  = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER , TIMER0_WAVE_FORM_GENERATION_BIT0);
-		TIMER0_CONTROL_REGIRSTER  = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER , TIMER0_WAVE_FORM_GENERATION_BIT1);
-
-		/*
-		 * Configure compare output mode to work with normal port operation
-		 * Decide the mode of OC0 from compare output modes with non PWM
-		 * Configure COM00 bit in TCCR0 register
-		 * Configure COM01 bit in TCCR0 register
-		 */
-		TIMER0_CONTROL_REGIRSTER = (TIMER0_CONTROL_REGIRSTER & TIMER0_COM0_MASK_CLEAR ) |
-				((config_PTR->Compare_Mode_NonPWM)<<COM0_SHIFT_VALUE);
-
-		/*
-		 * Configure FOC0 bit in the TCCR0 register to be active
-		 * As Timer0 is non-PWM
-		 * Make FOC0 to be Active as it is overflow mode
-		 */
-		TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER,TIMER0_FORCE_OUTPUT_COMPARE_BIT);
-
-		/*
-		 * Enable Timer0 overflow interrupt
-		 * wait for: -Enable I-bit "mask bit" in the SREG register
-		 *           -TOV0 bit in the TIFR register to be set
-		 * Timer0 overflow mode is ready to work after that
-		 */
-		TIMER0_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER0_INTERRUPT_MASK_REGISTER, TIMER0_OUTPUT_OVERFLOW_INTERRUPT);
-		break;
-
-
-	case PWM_PhaseCorrect:
-
-		/*
-		 * Configure OC0 as Output PIN
-		 * the pin where the PWM signal is generated from MC
-		 */
-
+	/*
+	 * Configure OC0 as Output PIN in the PWM modes
+	 * the pin where the PWM signal is generated from MC
+	 */
+	if((descriptor & MODE_OUTPUT_MASK) != MODE_OUTPUT_NON_PWM)
+	{
 		OC0_DIRECTION_PORT = SET_BIT(OC0_DIRECTION_PORT, OC0_PIN);
+	}
 
-		/*
-		 *Clear force output compare bit in Timer/Counter control register
-		 *to work with pulse width modulation
-		 */
-		TIMER0_CONTROL_REGIRSTER = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_FORCE_OUTPUT_COMPARE_BIT);
-
-		/*
-		 * Configure wave form generation mode to work with normal mode
-		 * SET WGM00 bit in TCCR0 register
-		 * Clear WGM01 bit in TCCR0 register
-		 */
-		TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT0);
-		TIMER0_CONTROL_REGIRSTER = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT1);
-
-		/*
-		 * Configure compare output mode to work with normal port operation
-		 * Decide the mode of OC0 from compare output modes with PWM_PhaseCorrect
-		 * Configure COM00 bit in TCCR0 register
-		 * Configure COM01 bit in TCCR0 register
-		 */
-		TIMER0_CONTROL_REGIRSTER = (TIMER0_CONTROL_REGIRSTER & TIMER0_COM0_MASK_CLEAR ) |
-				((config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM0_SHIFT_VALUE);
-
-		/*
-		 * Configure Compare match value for Timer0 to start count till reach it
-		 * Anding with 0XFF to make sure the value won't exceed
-		 * 255 as it is 8-bit Timer
-		 */
-		TIMER0_OUTPUT_COMPARE_REGISTER = ((config_PTR->timer0_compare_MatchValue)) & 0XFF;
-
-		break; /*End of PWM_PhaseCorrect*/
-
-
-	case CTC:
-
-		/*
-		 * Configure wave form generation mode to work with CTC mode
-		 * Clear WGM00 bit in TCCR0 register
-		 * Clear WGM01 bit in TCCR0 register
-		 */
-		TIMER0_CONTROL_REGIRSTER = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT0);
-		TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT1);
-
-		/*
-		 * Configure compare output mode to work with normal port operation
-		 * Decide the mode of OC0 from compare output modes with non PWM
-		 * Configure COM00 bit in TCCR0 register
-		 * Configure COM01 bit in TCCR0 register
-		 */
-		TIMER0_CONTROL_REGIRSTER = (TIMER0_CONTROL_REGIRSTER & TIMER0_COM0_MASK_CLEAR ) |
-				((config_PTR->Compare_Mode_NonPWM)<<COM0_SHIFT_VALUE);
-
-		/*
-		 * Configure FOC0 bit in the TCCR0 register to be active
-		 * As Timer0 is non-PWM
-		 * Make FOC0 to be Active as it is compare mode
-		 */
-		TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_FORCE_OUTPUT_COMPARE_BIT);
-
-		/*
-		 * Configure Compare match value for Timer0 to start count from it
-		 * Anding with 0XFF to make sure the value won't exceed
-		 * 255 as it is 8-bit Timer
-		 */
-		TIMER0_OUTPUT_COMPARE_REGISTER = ((config_PTR->timer0_compare_MatchValue)) & 0XFF;
+	/*
+	 * Configure wave form generation mode, compare output mode, FOC0
+	 * and Clock Pre-scaler value in one write to TCCR0 register
+	 */
+	TIMER0_CONTROL_REGIRSTER = Timer_8bitControlValue(mode, descriptor, compareMode) |
+			((config_PTR->timer0_clock) & ~TIMER0_CLOCK_MASK_CLEAR);
 
-		/*
-		 * Enable Timer0 compare match interrupt
-		 * wait for: -Enable I-bit "mask bit" in the SREG register
-		 *           -OCF0 bit in the TIFR register to be set
-		 * Timer0 compare match mode is ready to work after that
-		 */
+	/*
+	 * Enable Timer0 overflow or compare match interrupt
+	 * wait for: -Enable I-bit "mask bit" in the SREG register
+	 */
+	if(descriptor & MODE_OVERFLOW_INTERRUPT)
+	{
+		TIMER0_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER0_INTERRUPT_MASK_REGISTER, TIMER0_OUTPUT_OVERFLOW_INTERRUPT);
+	}
+	if(descriptor & MODE_COMPARE_INTERRUPT)
+	{
 		TIMER0_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER0_INTERRUPT_MASK_REGISTER, TIMER0_OUTPUT_COMPARE_MATCH_INTERRUPT);
-
-		break; /*End of compare mode*/
-
-	case FAST_PWM:
-		/*
-		 * Configure OC0 as Output PIN
-		 * the pin where the PWM signal is generated from MC
-		 */
-
-		OC0_DIRECTION_PORT = SET_BIT(OC0_DIRECTION_PORT, OC0_PIN);
-
-		/*
-		 *Clear force output compare bit in Timer/Counter control register
-		 *to work with pulse width modulation
-		 */
-		TIMER0_CONTROL_REGIRSTER = CLEAR_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_FORCE_OUTPUT_COMPARE_BIT);
-
-		/*
-		 * Configure wave form generation mode to work with FAST PWM mode
-		 * SET WGM00 bit in TCCR0 register
-		 * SET WGM01 bit in TCCR0 register
-		 */
-		TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT0);
-		TIMER0_CONTROL_REGIRSTER = SET_BIT(TIMER0_CONTROL_REGIRSTER, TIMER0_WAVE_FORM_GENERATION_BIT1);
-
-		/*
-		 * Configure compare output mode to work with normal port operation
-		 * Decide the mode of OC0 from compare output modes with Fast PWM
-		 * Configure COM00 bit in TCCR0 register
-		 * Configure COM01 bit in TCCR0 register
-		 */
-		TIMER0_CONTROL_REGIRSTER = (TIMER0_CONTROL_REGIRSTER & TIMER0_COM0_MASK_CLEAR ) |
-				((config_PTR->Compare_Mode_FASTPWM)<<COM0_SHIFT_VALUE);
-
-		/*
-		 * Configure Compare match value for Timer0 to start count till reach it
-		 * Anding with 0XFF to make sure the value won't exceed
-		 * 255 as it is 8-bit Timer
-		 */
-		TIMER0_OUTPUT_COMPARE_REGISTER = ((config_PTR->timer0_compare_MatchValue)) & 0XFF;
-
-		break;/*End of Fast PWM*/
-	}/*End of switch case for timer0_mode*/
+	}
 
 }/*End of Timer0_Init*/
 
@@ -337,7 +531,11 @@ void Timer0_Init(const Timer0_ConfigType* config_PTR)
  ***************************************************************************************************/
 void Timer0_setCallBack( void(*a_ptr)(void) )
 {
-	g_Timer0_callBackPtr = a_ptr;
+	/*
+	 * Same call back for the overflow and the compare interrupts
+	 */
+	IsrDispatch_setCallBack(&g_Timer_subscribers[Timer0_OVF_Vector], a_ptr);
+	IsrDispatch_setCallBack(&g_Timer_subscribers[Timer0_COMP_Vector], a_ptr);
 }
 /***************************************************************************************************
  * [Function Name]: Timer0_DeInit
@@ -459,1341 +657,138 @@ void Timer0_Change_CompareMatchValue(uint8 timer0_newCompareValue)
  ***************************************************************************************************/
 void Timer1_Init(const Timer1_ConfigType* Timer1_config_PTR)
 {
+	uint8 mode = (uint8)(Timer1_config_PTR->timer1_mode);
+	uint8 descriptor = pgm_read_byte(&g_Timer1_modes[mode]);
+	uint8 compareMode = Timer_selectCompareMode(descriptor, Timer1_config_PTR->Compare_Mode_NonPWM,
+			Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect, Timer1_config_PTR->Compare_Mode_FASTPWM);
+	uint8 controlA;
 
 	/*
 	 * Configure initial value for Timer1 to start count from it
-	 * Anding with 0XFFFF to make sure the value won't exceed
-	 *  0XFFFF as it is 16-bit Timer
 	 */
-	TIMER1_INITIAL_VALUE_REGISTER = ( (Timer1_config_PTR->timer1_InitialValue) ) & 0XFFFF;
+	TIMER1_INITIAL_VALUE_REGISTER = Timer1_config_PTR->timer1_InitialValue;
+
+	if(descriptor & MODE_RESERVED)
+	{
+		/*
+		 * No waveform for the reserved mode, only the clock is configured
+		 */
+		TIMER1_CONTROL_REGIRSTER_A = 0X00;
+		TIMER1_CONTROL_REGIRSTER_B = (TIMER1_CONTROL_REGIRSTER_B & TIMER1_CLOCK_MASK_CLEAR) |
+				(Timer1_config_PTR->timer1_clock);
+		return;
+	}
+
+	/*
+	 * Configure the TOP value of the ICR1 modes
+	 */
+	if(descriptor & MODE_INPUT_CAPTURE_TOP)
+	{
+		TIMER1_INPUT_CAPTURE_REGISTER = Timer1_config_PTR->timer1_InputCaptureValue;
+	}
 
 	/*
-	 * Configure Clock Pre-scaler value for Timer0 in TCCR1B Register
-	 * Anding with 0XF8 to make sure the first 3-bits in TCCR1B register=0
-	 * ORing with the selected timer clock to include it in the first 3-bits
-	 * and keep the other bits as they are
+	 * WGM11:10 are the low 2-bits of the mode number
 	 */
-	TIMER1_CONTROL_REGIRSTER_B =  (TIMER1_CONTROL_REGIRSTER_B & TIMER1_CLOCK_MASK_CLEAR) |
-			(Timer1_config_PTR->timer1_clock);
+	controlA = (uint8)((mode & WGM_16BIT_LOW_MASK) << WGM10_BIT);
 
-	switch ( (Timer1_config_PTR->timer1_mode) )
+	switch(Timer1_config_PTR->channel)
 	{
-	/**************************************************************************
-	 *                            Timer1_Normal_Mode
-	 * ************************************************************************/
-	case Normal:
+	case ChannelA:
 		/*
-		 * Configure wave form generation mode to work with normal mode
-		 * Clear WGM10/WMG11 bit in TCCR1A register
+		 * Configure compare output mode of channel A, FOC1A is active in the
+		 * non-PWM modes and OC1A is Output PIN in the PWM modes
 		 */
-		TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-		TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
+		controlA |= (uint8)(compareMode << COM1A_SHIFT_VALUE);
+		if((descriptor & MODE_OUTPUT_MASK) == MODE_OUTPUT_NON_PWM)
+		{
+			controlA |= (1<<TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
+		}
+		else
+		{
+			OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
+		}
+
+		if(descriptor & MODE_COMPARE_VALUE)
+		{
+			TIMER1_OUTPUT_COMPARE_REGISTER_A = Timer1_config_PTR->timer1_compare_MatchValue;
+		}
+		break; /*End of Channel A*/
 
+	case ChannelB:
 		/*
-		 * Configure wave form generation mode to work with normal mode
-		 * Clear WGM12/WMG13 bit in TCCR1B register
+		 * Configure compare output mode of channel B, FOC1B is active in the
+		 * non-PWM modes and OC1B is Output PIN in the PWM modes
 		 */
-		TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-		TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-		switch( (Timer1_config_PTR->channel) )
+		controlA |= (uint8)(compareMode << COM1B_SHIFT_VALUE);
+		if((descriptor & MODE_OUTPUT_MASK) == MODE_OUTPUT_NON_PWM)
 		{
-
-		case ChannelA:
-			/*
-			 * Configure compare output mode to work with Timer1
-			 * with one mode from 4 modes in TCCR1A
-			 * Configure COM1A0/COM1A1 bits in TCCR1A register
-			 */
-			TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-			((Timer1_config_PTR->Compare_Mode_NonPWM)<<COM1A_SHIFT_VALUE);
-
-			/*
-			 * Configure FOC1A bit in the TCCR1 register to be active
-			 * As Timer1 is non-PWM
-			 * Make FOC1A to be Active as it is overflow mode
-			 */
-			TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-
-			break; /*End of Channel A*/
-
-		case ChannelB:
-
-			/*
-			 * Configure compare output mode to work with Timer1
-			 * with one mode from 4 modes in TCCR1A
-			 * Configure COM1B0/COM1B1 bits in TCCR1A register
-			 */
-			TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-			((Timer1_config_PTR->Compare_Mode_NonPWM)<<COM1B_SHIFT_VALUE);
-
-			/*
-			 * Configure FOC1B bit in the TCCR1 register to be active
-			 * As Timer1 is non-PWM
-			 * Make FOC1B to be Active as it is overflow mode
-			 */
-			TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-			break;/*End of channel B*/
-		}/*End of Channel Type*/
+			controlA |= (1<<TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
+		}
+		else
+		{
+			OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
+		}
 
 		/*
-		 * Enable Timer1 overflow interrupt
-		 * wait for: -Enable I-bit "mask bit" in the SREG register
-		 *           -TOV1 bit in the TIFR register to be set
-		 * Timer1 overflow mode is ready to work after that
+		 * to make it count right put OCR1A greater than the value in OCR1B by 1
 		 */
-		TIMER1_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER,TIMER1_OUTPUT_OVERFLOW_INTERRUPT);
-		break; /*end of normal mode*/
-		/**************************************************************************
-		 *                     Timer1_PWM_PhaseCorrect_8bit_Mode
-		 * ************************************************************************/
-		case PWM_PhaseCorrect_8bit:
-			/*
-			 * Configure wave form generation mode to work with PWM_PhaseCorrect_8bit mode
-			 * Set WGM10 bit in TCCR1A register
-			 * Clear WGM11 bit in TCCR1A register
-			 */
-			TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-			TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-			/*
-			 * Configure wave form generation mode to work with PWM_PhaseCorrect_8bit mode
-			 * Clear WGM12/WMG13 bit in TCCR1B register
-			 */
-			TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-			TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-			switch(Timer1_config_PTR->channel)
-			{
-
-			case ChannelA:
-				/*
-				 * Configure OC1A as Output PIN
-				 * the pin where the PWM signal is generated from MC
-				 */
-				OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-				/*
-				 * Configure FOC1A bit in the TCCR1 register to be low
-				 * As Timer1 is PWM mode
-				 * Make FOC1A to be low as it is PWM_PhaseCorrect_8bit mode
-				 */
-				TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-				/*
-				 * Configure compare output mode to work with Timer1
-				 * with one mode from 4 modes in TCCR1A
-				 * Configure COM1A0/COM1A1 bits in TCCR1A register
-				 */
-				TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-						((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1A_SHIFT_VALUE);
-				/*
-				 * Configure Compare match value for Timer1 to start count from it
-				 * Anding with 0XFFFF to make sure the value won't exceed
-				 * OXFFFF as it is 16-bit Timer
-				 */
-				TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-				break; /*End of channel A*/
-
-			case ChannelB:
-				/*
-				 * Configure OC1A as Output PIN
-				 * the pin where the PWM signal is generated from MC
-				 */
-				OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-				/*
-				 * Configure FOC1B bit in the TCCR1 register to be low
-				 * As Timer1 is PWM
-				 * Make FOC1B to be low as it is PWM_PhaseCorrect_8bit mode
-				 */
-				TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-				/*
-				 * Configure compare output mode to work with Timer1
-				 * with one mode from 4 modes in TCCR1A
-				 * Configure COM1B0/COM1B1 bits in TCCR1A register
-				 */
-				TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-						((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1B_SHIFT_VALUE);
-
-				/*
-				 * Configure Compare match value for Timer1 to start count from it
-				 * Anding with 0XFFFF to make sure the value won't exceed
-				 * OXFFFF as it is 16-bit Timer
-				 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-				 */
-				TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-				TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-				break;/*End of channel B*/
-			}/*End of Channel Type switch case*/
-			break;/*End of PWM_PhaseCorrect_8bit mode*/
-			/**************************************************************************
-			 *                     Timer1_PWM_PhaseCorrect_9bit_Mode
-			 * ************************************************************************/
-			case PWM_PhaseCorrect_9bit:
-				/*
-				 * Configure wave form generation mode to work with PWM_PhaseCorrect_9bit mode
-				 * Clear WGM10 bit in TCCR1A register
-				 * Set WGM11 bit in TCCR1A register
-				 */
-				TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-				TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-				/*
-				 * Configure wave form generation mode to work with PWM_PhaseCorrect_9bit mode
-				 * Clear WGM12/WMG13 bit in TCCR1B register
-				 */
-				TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-				TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-				switch(Timer1_config_PTR->channel)
-				{
-
-				case ChannelA:
-					/*
-					 * Configure OC1A as Output PIN
-					 * the pin where the PWM signal is generated from MC
-					 */
-					OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-					/*
-					 * Configure FOC1A bit in the TCCR1 register to be low
-					 * As Timer1 is PWM mode
-					 * Make FOC1A to be low as it is PWM_PhaseCorrect_9bit mode
-					 */
-					TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-					/*
-					 * Configure compare output mode to work with Timer1
-					 * with one mode from 4 modes in TCCR1A
-					 * Configure COM1A0/COM1A1 bits in TCCR1A register
-					 */
-					TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-							((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1A_SHIFT_VALUE);
-					/*
-					 * Configure Compare match value for Timer1 to start count from it
-					 * Anding with 0XFFFF to make sure the value won't exceed
-					 * OXFFFF as it is 16-bit Timer
-					 */
-					TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-					break; /*End of channel A*/
-
-				case ChannelB:
-					/*
-					 * Configure OC1A as Output PIN
-					 * the pin where the PWM signal is generated from MC
-					 */
-					OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-					/*
-					 * Configure FOC1B bit in the TCCR1 register to be low
-					 * As Timer1 is PWM
-					 * Make FOC1B to be low as it is PWM_PhaseCorrect_9bit mode
-					 */
-					TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-					/*
-					 * Configure compare output mode to work with Timer1
-					 * with one mode from 4 modes in TCCR1A
-					 * Configure COM1B0/COM1B1 bits in TCCR1A register
-					 */
-					TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-							((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1B_SHIFT_VALUE);
-
-					/*
-					 * Configure Compare match value for Timer1 to start count from it
-					 * Anding with 0XFFFF to make sure the value won't exceed
-					 * OXFFFF as it is 16-bit Timer
-					 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-					 */
-					TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-					TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-					break;/*End of channel B*/
-				}/*End of Channel Type switch case*/
-				break;/*End of PWM_PhaseCorrect_9bit mode*/
-				/**************************************************************************
-				 *                     Timer1_PWM_PhaseCorrect_10bit_Mode
-				 * ************************************************************************/
-				case PWM_PhaseCorrect_10bit:
-					/*
-					 * Configure wave form generation mode to work with PWM_PhaseCorrect_10bit mode
-					 * Set WGM10 bit in TCCR1A register
-					 * Set WGM11 bit in TCCR1A register
-					 */
-					TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-					TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-					/*
-					 * Configure wave form generation mode to work with PWM_PhaseCorrect_10bit mode
-					 * Clear WGM12/WMG13 bit in TCCR1B register
-					 */
-					TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-					TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-					switch(Timer1_config_PTR->channel)
-					{
-
-					case ChannelA:
-						/*
-						 * Configure OC1A as Output PIN
-						 * the pin where the PWM signal is generated from MC
-						 */
-						OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-						/*
-						 * Configure FOC1A bit in the TCCR1 register to be low
-						 * As Timer1 is PWM mode
-						 * Make FOC1A to be low as it is PWM_PhaseCorrect_10bit mode
-						 */
-						TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-						/*
-						 * Configure compare output mode to work with Timer1
-						 * with one mode from 4 modes in TCCR1A
-						 * Configure COM1A0/COM1A1 bits in TCCR1A register
-						 */
-						TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-								((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1A_SHIFT_VALUE);
-						/*
-						 * Configure Compare match value for Timer1 to start count from it
-						 * Anding with 0XFFFF to make sure the value won't exceed
-						 * OXFFFF as it is 16-bit Timer
-						 */
-						TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-						break; /*End of channel A*/
-
-					case ChannelB:
-						/*
-						 * Configure OC1A as Output PIN
-						 * the pin where the PWM signal is generated from MC
-						 */
-						OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-						/*
-						 * Configure FOC1B bit in the TCCR1 register to be low
-						 * As Timer1 is PWM
-						 * Make FOC1B to be low as it is PWM_PhaseCorrect_10bit mode
-						 */
-						TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-						/*
-						 * Configure compare output mode to work with Timer1
-						 * with one mode from 4 modes in TCCR1A
-						 * Configure COM1B0/COM1B1 bits in TCCR1A register
-						 */
-						TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-								((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1B_SHIFT_VALUE);
-
-						/*
-						 * Configure Compare match value for Timer1 to start count from it
-						 * Anding with 0XFFFF to make sure the value won't exceed
-						 * OXFFFF as it is 16-bit Timer
-						 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-						 */
-						TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-						TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-						break;/*End of channel B*/
-					}/*End of Channel Type switch case*/
-					break;/*End of PWM_PhaseCorrect_10bit*/
-					/**************************************************************************
-					 *                        Timer1_CTC_OCR1A_Mode
-					 * ************************************************************************/
-					case CTC_OCR1A:
-
-						/*
-						 * Configure wave form generation mode to work with compare mode
-						 * Clear WGM10/WMG11 bit in TCCR1A register
-						 */
-						TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-						TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-						/*
-						 * Configure wave form generation mode to work with normal mode
-						 * Clear WMG13 bit in TCCR1B register
-						 * Set WMG12 bit in TCCR1B register
-						 */
-						TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-						TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-						switch(Timer1_config_PTR->channel)
-						{
-
-						case ChannelA:
-
-							/*
-							 * Configure FOC1A bit in the TCCR1 register to be active
-							 * As Timer1 is non-PWM
-							 * Make FOC1A to be Active as it is compare mode
-							 */
-							TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-							/*
-							 * Configure compare output mode to work with Timer1
-							 * with one mode from 4 modes in TCCR1A
-							 * Configure COM1A0/COM1A1 bits in TCCR1A register
-							 */
-							TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-									((Timer1_config_PTR->Compare_Mode_NonPWM)<<COM1A_SHIFT_VALUE);
-							/*
-							 * Configure Compare match value for Timer1 to start count from it
-							 * Anding with 0XFFFF to make sure the value won't exceed
-							 * OXFFFF as it is 16-bit Timer
-							 */
-							TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-							/*
-							 * Enable Timer1 compare match interrupt
-							 * wait for: -Enable I-bit "mask bit" in the SREG register
-							 *           -OCF1 bit in the TIFR register to be set
-							 * Timer1 compare match mode is ready to work after that
-							 */
-							TIMER1_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER,TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_A);
-
-							break; /*End of channel A*/
-
-						case ChannelB:
-
-							/*
-							 * Configure FOC1B bit in the TCCR1 register to be active
-							 * As Timer1 is non-PWM
-							 * Make FOC1B to be Active as it is compare mode
-							 */
-							TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-							/*
-							 * Configure compare output mode to work with Timer1
-							 * with one mode from 4 modes in TCCR1A
-							 * Configure COM1B0/COM1B1 bits in TCCR1A register
-							 */
-							TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-									((Timer1_config_PTR->Compare_Mode_NonPWM)<<COM1B_SHIFT_VALUE);
-
-							/*
-							 * Configure Compare match value for Timer1 to start count from it
-							 * Anding with 0XFFFF to make sure the value won't exceed
-							 * OXFFFF as it is 16-bit Timer
-							 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-							 */
-							TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-							TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-							/*
-							 * Enable Timer1 compare match interrupt
-							 * wait for: -Enable I-bit "mask bit" in the SREG register
-							 *           -OCF1 bit in the TIFR register to be set
-							 * Timer1 compare match mode is ready to work after that
-							 */
-							TIMER1_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER,TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_B);
-
-							break;/*End of channel B*/
-						}/*End of Channel Type switch case*/
-						break;/*End of CTC_OCR1A mode*/
-						/**************************************************************************
-						 *                        Timer1_FAST_PWM_8bit_Mode
-						 * ************************************************************************/
-						case FAST_PWM_8bit:
-
-							/*
-							 * Configure wave form generation mode to work with FAST_PWM_8bit mode
-							 * Set WGM10 bit in TCCR1A register
-							 * Clear WGM11 bit in TCCR1A register
-							 */
-							TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-							TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-							/*
-							 * Configure wave form generation mode to work with FAST_PWM_8bit mode
-							 * Set WGM12 bit in TCCR1B register
-							 * Clear WMG13 bit in TCCR1B register
-							 */
-							TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-							TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-							switch(Timer1_config_PTR->channel)
-							{
-
-							case ChannelA:
-								/*
-								 * Configure OC1A as Output PIN
-								 * the pin where the PWM signal is generated from MC
-								 */
-								OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-								/*
-								 * Configure FOC1A bit in the TCCR1 register to be low
-								 * As Timer1 is PWM mode
-								 * Make FOC1A to be low as it is FAST_PWM_8bit mode
-								 */
-								TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-								/*
-								 * Configure compare output mode to work with Timer1
-								 * with one mode from 4 modes in TCCR1A
-								 * Configure COM1A0/COM1A1 bits in TCCR1A register
-								 */
-								TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-										((Timer1_config_PTR->Compare_Mode_FASTPWM)<<COM1A_SHIFT_VALUE);
-								/*
-								 * Configure Compare match value for Timer1 to start count from it
-								 * Anding with 0XFFFF to make sure the value won't exceed
-								 * OXFFFF as it is 16-bit Timer
-								 */
-								TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-								break; /*End of channel A*/
-
-							case ChannelB:
-								/*
-								 * Configure OC1A as Output PIN
-								 * the pin where the PWM signal is generated from MC
-								 */
-								OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-								/*
-								 * Configure FOC1B bit in the TCCR1 register to be low
-								 * As Timer1 is PWM
-								 * Make FOC1B to be low as it is FAST_PWM_8bit mode
-								 */
-								TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-								/*
-								 * Configure compare output mode to work with Timer1
-								 * with one mode from 4 modes in TCCR1A
-								 * Configure COM1B0/COM1B1 bits in TCCR1A register
-								 */
-								TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-										((Timer1_config_PTR->Compare_Mode_FASTPWM)<<COM1B_SHIFT_VALUE);
-
-								/*
-								 * Configure Compare match value for Timer1 to start count from it
-								 * Anding with 0XFFFF to make sure the value won't exceed
-								 * OXFFFF as it is 16-bit Timer
-								 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-								 */
-								TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-								TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-								break;/*End of channel B*/
-							}/*End of Channel Type switch case*/
-
-							break;/*End of FAST_PWM_8BIT*/
-							/**************************************************************************
-							 *                        Timer1_FAST_PWM_9bit_Mode
-							 * ************************************************************************/
-							case FAST_PWM_9bit:
-
-								/*
-								 * Configure wave form generation mode to work with FAST_PWM_9bit mode
-								 * Clear WGM10 bit in TCCR1A register
-								 * Set WGM11 bit in TCCR1A register
-								 */
-								TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-								TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-								/*
-								 * Configure wave form generation mode to work with FAST_PWM_9bit mode
-								 * Set WGM12 bit in TCCR1B register
-								 * Clear WMG13 bit in TCCR1B register
-								 */
-								TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-								TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-								switch(Timer1_config_PTR->channel)
-								{
-
-								case ChannelA:
-									/*
-									 * Configure OC1A as Output PIN
-									 * the pin where the PWM signal is generated from MC
-									 */
-									OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-									/*
-									 * Configure FOC1A bit in the TCCR1 register to be low
-									 * As Timer1 is PWM mode
-									 * Make FOC1A to be low as it is FAST_PWM_9bit mode
-									 */
-									TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-									/*
-									 * Configure compare output mode to work with Timer1
-									 * with one mode from 4 modes in TCCR1A
-									 * Configure COM1A0/COM1A1 bits in TCCR1A register
-									 */
-									TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-											((Timer1_config_PTR->Compare_Mode_FASTPWM)<<COM1A_SHIFT_VALUE);
-									/*
-									 * Configure Compare match value for Timer1 to start count from it
-									 * Anding with 0XFFFF to make sure the value won't exceed
-									 * OXFFFF as it is 16-bit Timer
-									 */
-									TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-									break; /*End of channel A*/
-
-								case ChannelB:
-									/*
-									 * Configure OC1A as Output PIN
-									 * the pin where the PWM signal is generated from MC
-									 */
-									OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-									/*
-									 * Configure FOC1B bit in the TCCR1 register to be low
-									 * As Timer1 is PWM
-									 * Make FOC1B to be low as it is FAST_PWM_9bit mode
-									 */
-									TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-									/*
-									 * Configure compare output mode to work with Timer1
-									 * with one mode from 4 modes in TCCR1A
-									 * Configure COM1B0/COM1B1 bits in TCCR1A register
-									 */
-									TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-											((Timer1_config_PTR->Compare_Mode_FASTPWM)<<COM1B_SHIFT_VALUE);
-
-									/*
-									 * Configure Compare match value for Timer1 to start count from it
-									 * Anding with 0XFFFF to make sure the value won't exceed
-									 * OXFFFF as it is 16-bit Timer
-									 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-									 */
-									TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-									TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-									break;/*End of channel B*/
-								}/*End of Channel Type switch case*/
-								break;/*End of FAST_PWM_9BIT*/
-								/**************************************************************************
-								 *                        Timer1_FAST_PWM_10bit_Mode
-								 * ************************************************************************/
-								case FAST_PWM_10bit:
-
-									/*
-									 * Configure wave form generation mode to work with FAST_PWM_10bit mode
-									 * Set WGM10 bit in TCCR1A register
-									 * Set WGM11 bit in TCCR1A register
-									 */
-									TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-									TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-									/*
-									 * Configure wave form generation mode to work with FAST_PWM_10bit mode
-									 * Set WGM12 bit in TCCR1B register
-									 * Clear WMG13 bit in TCCR1B register
-									 */
-									TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-									TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-									switch(Timer1_config_PTR->channel)
-									{
-
-									case ChannelA:
-										/*
-										 * Configure OC1A as Output PIN
-										 * the pin where the PWM signal is generated from MC
-										 */
-										OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-										/*
-										 * Configure FOC1A bit in the TCCR1 register to be low
-										 * As Timer1 is PWM mode
-										 * Make FOC1A to be low as it is FAST_PWM_10bit mode
-										 */
-										TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-										/*
-										 * Configure compare output mode to work with Timer1
-										 * with one mode from 4 modes in TCCR1A
-										 * Configure COM1A0/COM1A1 bits in TCCR1A register
-										 */
-										TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-												((Timer1_config_PTR->Compare_Mode_FASTPWM)<<COM1A_SHIFT_VALUE);
-										/*
-										 * Configure Compare match value for Timer1 to start count from it
-										 * Anding with 0XFFFF to make sure the value won't exceed
-										 * OXFFFF as it is 16-bit Timer
-										 */
-										TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-										break; /*End of channel A*/
-
-									case ChannelB:
-										/*
-										 * Configure OC1A as Output PIN
-										 * the pin where the PWM signal is generated from MC
-										 */
-										OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-										/*
-										 * Configure FOC1B bit in the TCCR1 register to be low
-										 * As Timer1 is PWM
-										 * Make FOC1B to be low as it is FAST_PWM_10bit mode
-										 */
-										TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-										/*
-										 * Configure compare output mode to work with Timer1
-										 * with one mode from 4 modes in TCCR1A
-										 * Configure COM1B0/COM1B1 bits in TCCR1A register
-										 */
-										TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-												((Timer1_config_PTR->Compare_Mode_FASTPWM)<<COM1B_SHIFT_VALUE);
-
-										/*
-										 * Configure Compare match value for Timer1 to start count from it
-										 * Anding with 0XFFFF to make sure the value won't exceed
-										 * OXFFFF as it is 16-bit Timer
-										 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-										 */
-										TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-										TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-										break;/*End of channel B*/
-									}/*End of Channel Type switch case*/
-									break;/*End of FAST_PMW_10BIT mode*/
-									/**************************************************************************
-									 *                      Timer1_PWM_Phase_FrequencyCorrect_ICR1_Mode
-									 * ************************************************************************/
-									case PWM_Phase_FrequencyCorrect_ICR1:
-										/*
-										 * Configure wave form generation mode to work with PWM_Phase_FrequencyCorrect_ICR1 mode
-										 * Clear WGM10 bit in TCCR1A register
-										 * Clear WGM11 bit in TCCR1A register
-										 */
-										TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-										TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-										/*
-										 * Configure wave form generation mode to work with PWM_Phase_FrequencyCorrect_ICR1 mode
-										 * Clear WGM12 bit in TCCR1B register
-										 * Set WMG13 bit in TCCR1B register
-										 */
-										TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-										TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-										/*
-										 * Configure Input capture value for Timer1 to be the top from it
-										 * Anding with 0XFFFF to make sure the value won't exceed
-										 * OXFFFF as it is 16-bit Timer
-										 */
-										TIMER1_INPUT_CAPTURE_REGISTER  = ( (Timer1_config_PTR->timer1_InputCaptureValue) & 0XFFFF) ;
-
-										switch(Timer1_config_PTR->channel)
-										{
-
-										case ChannelA:
-											/*
-											 * Configure OC1A as Output PIN
-											 * the pin where the PWM signal is generated from MC
-											 */
-											OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-											/*
-											 * Configure FOC1A bit in the TCCR1 register to be low
-											 * As Timer1 is PWM mode
-											 * Make FOC1A to be low as it is FAST_PWM_10bit mode
-											 */
-											TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-											/*
-											 * Configure compare output mode to work with Timer1
-											 * with one mode from 4 modes in TCCR1A
-											 * Configure COM1A0/COM1A1 bits in TCCR1A register
-											 */
-											TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-													((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1A_SHIFT_VALUE);
-											/*
-											 * Configure Compare match value for Timer1 to start count from it
-											 * Anding with 0XFFFF to make sure the value won't exceed
-											 * OXFFFF as it is 16-bit Timer
-											 */
-											TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-											break; /*End of channel A*/
-
-										case ChannelB:
-											/*
-											 * Configure OC1A as Output PIN
-											 * the pin where the PWM signal is generated from MC
-											 */
-											OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-											/*
-											 * Configure FOC1B bit in the TCCR1 register to be low
-											 * As Timer1 is PWM
-											 * Make FOC1B to be low as it is FAST_PWM_10bit mode
-											 */
-											TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-											/*
-											 * Configure compare output mode to work with Timer1
-											 * with one mode from 4 modes in TCCR1A
-											 * Configure COM1B0/COM1B1 bits in TCCR1A register
-											 */
-											TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-													((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1B_SHIFT_VALUE);
-
-											/*
-											 * Configure Compare match value for Timer1 to start count from it
-											 * Anding with 0XFFFF to make sure the value won't exceed
-											 * OXFFFF as it is 16-bit Timer
-											 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-											 */
-											TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-											TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-											break;/*End of channel B*/
-										}/*End of Channel Type switch case*/
-										break;/*End of PWM_Phase_FrequencyCorrect_ICR1 mode*/
-										/**************************************************************************
-										 *                Timer1_PWM_Phase_FrequencyCorrect_OCR1A_Mode
-										 * ************************************************************************/
-										case PWM_Phase_FrequencyCorrect_OCR1A:
-											/*
-											 * Configure wave form generation mode to work with PWM_Phase_FrequencyCorrect_OCR1A mode
-											 * Set WGM10 bit in TCCR1A register
-											 * Clear WGM11 bit in TCCR1A register
-											 */
-											TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-											TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-											/*
-											 * Configure wave form generation mode to work with PWM_Phase_FrequencyCorrect_OCR1A mode
-											 * Clear WGM12 bit in TCCR1B register
-											 * Set WMG13 bit in TCCR1B register
-											 */
-											TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-											TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-											switch(Timer1_config_PTR->channel)
-											{
-
-											case ChannelA:
-												/*
-												 * Configure OC1A as Output PIN
-												 * the pin where the PWM signal is generated from MC
-												 */
-												OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-												/*
-												 * Configure FOC1A bit in the TCCR1 register to be low
-												 * As Timer1 is PWM mode
-												 * Make FOC1A to be low as it is FAST_PWM_10bit mode
-												 */
-												TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-												/*
-												 * Configure compare output mode to work with Timer1
-												 * with one mode from 4 modes in TCCR1A
-												 * Configure COM1A0/COM1A1 bits in TCCR1A register
-												 */
-												TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-														((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1A_SHIFT_VALUE);
-												/*
-												 * Configure Compare match value for Timer1 to start count from it
-												 * Anding with 0XFFFF to make sure the value won't exceed
-												 * OXFFFF as it is 16-bit Timer
-												 */
-												TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-												break; /*End of channel A*/
-
-											case ChannelB:
-												/*
-												 * Configure OC1A as Output PIN
-												 * the pin where the PWM signal is generated from MC
-												 */
-												OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-												/*
-												 * Configure FOC1B bit in the TCCR1 register to be low
-												 * As Timer1 is PWM
-												 * Make FOC1B to be low as it is FAST_PWM_10bit mode
-												 */
-												TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-												/*
-												 * Configure compare output mode to work with Timer1
-												 * with one mode from 4 modes in TCCR1A
-												 * Configure COM1B0/COM1B1 bits in TCCR1A register
-												 */
-												TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-														((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1B_SHIFT_VALUE);
-
-												/*
-												 * Configure Compare match value for Timer1 to start count from it
-												 * Anding with 0XFFFF to make sure the value won't exceed
-												 * OXFFFF as it is 16-bit Timer
-												 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-												 */
-												TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-												TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-												break;/*End of channel B*/
-											}/*End of Channel Type switch case*/
-											break;/*End of PWM_Phase_FrequencyCorrct_OCR1A mode*/
-											/**************************************************************************
-											 *                    Timer1_PWM_PhaseCorrect_ICR1_Mode
-											 * ************************************************************************/
-											case PWM_PhaseCorrect_ICR1:
-												/*
-												 * Configure wave form generation mode to work with PWM_PhaseCorrect_ICR1 mode
-												 * Clear WGM10 bit in TCCR1A register
-												 * Clear WGM11 bit in TCCR1A register
-												 */
-												TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-												TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-												/*
-												 * Configure wave form generation mode to work with PWM_PhaseCorrect_ICR1 mode
-												 * Clear WGM12 bit in TCCR1B register
-												 * Set WMG13 bit in TCCR1B register
-												 */
-												TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-												TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-												/*
-												 * Configure Input capture value for Timer1 to be the top from it
-												 * Anding with 0XFFFF to make sure the value won't exceed
-												 * OXFFFF as it is 16-bit Timer
-												 */
-												TIMER1_INPUT_CAPTURE_REGISTER  = ( (Timer1_config_PTR->timer1_InputCaptureValue) & 0XFFFF) ;
-
-												switch(Timer1_config_PTR->channel)
-												{
-
-												case ChannelA:
-													/*
-													 * Configure OC1A as Output PIN
-													 * the pin where the PWM signal is generated from MC
-													 */
-													OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-													/*
-													 * Configure FOC1A bit in the TCCR1 register to be low
-													 * As Timer1 is PWM mode
-													 * Make FOC1A to be low as it is FAST_PWM_10bit mode
-													 */
-													TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-													/*
-													 * Configure compare output mode to work with Timer1
-													 * with one mode from 4 modes in TCCR1A
-													 * Configure COM1A0/COM1A1 bits in TCCR1A register
-													 */
-													TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-															((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1A_SHIFT_VALUE);
-													/*
-													 * Configure Compare match value for Timer1 to start count from it
-													 * Anding with 0XFFFF to make sure the value won't exceed
-													 * OXFFFF as it is 16-bit Timer
-													 */
-													TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-													break; /*End of channel A*/
-
-												case ChannelB:
-													/*
-													 * Configure OC1A as Output PIN
-													 * the pin where the PWM signal is generated from MC
-													 */
-													OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-													/*
-													 * Configure FOC1B bit in the TCCR1 register to be low
-													 * As Timer1 is PWM
-													 * Make FOC1B to be low as it is FAST_PWM_10bit mode
-													 */
-													TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-													/*
-													 * Configure compare output mode to work with Timer1
-													 * with one mode from 4 modes in TCCR1A
-													 * Configure COM1B0/COM1B1 bits in TCCR1A register
-													 */
-													TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-															((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1B_SHIFT_VALUE);
-
-													/*
-													 * Configure Compare match value for Timer1 to start count from it
-													 * Anding with 0XFFFF to make sure the value won't exceed
-													 * OXFFFF as it is 16-bit Timer
-													 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-													 */
-													TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-													TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-													break;/*End of channel B*/
-												}/*End of Channel Type switch case*/
-												break;/*End of PWM_PhaseCorrect_ICR1s mode*/
-												/**************************************************************************
-												 *                    Timer1_PWM_PhaseCorrect_OCR1A_Mode
-												 * ************************************************************************/
-												case PWM_PhaseCorrect_OCR1A:
-													/*
-													 * Configure wave form generation mode to work with PWM_Phase_FrequencyCorrect_OCR1A mode
-													 * Set WGM10 bit in TCCR1A register
-													 * Set WGM11 bit in TCCR1A register
-													 */
-													TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-													TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-													/*
-													 * Configure wave form generation mode to work with PWM_Phase_FrequencyCorrect_OCR1A mode
-													 * Clear WGM12 bit in TCCR1B register
-													 * Set WMG13 bit in TCCR1B register
-													 */
-													TIMER1_CONTROL_REGIRSTER_B =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-													TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-													switch(Timer1_config_PTR->channel)
-													{
-
-													case ChannelA:
-														/*
-														 * Configure OC1A as Output PIN
-														 * the pin where the PWM signal is generated from MC
-														 */
-														OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-														/*
-														 * Configure FOC1A bit in the TCCR1 register to be low
-														 * As Timer1 is PWM mode
-														 * Make FOC1A to be low as it is PWM_PhaseCorrect_OCR1A mode
-														 */
-														TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-														/*
-														 * Configure compare output mode to work with Timer1
-														 * with one mode from 4 modes in TCCR1A
-														 * Configure COM1A0/COM1A1 bits in TCCR1A register
-														 */
-														TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-																((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1A_SHIFT_VALUE);
-														/*
-														 * Configure Compare match value for Timer1 to start count from it
-														 * Anding with 0XFFFF to make sure the value won't exceed
-														 * OXFFFF as it is 16-bit Timer
-														 */
-														TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-														break; /*End of channel A*/
-
-													case ChannelB:
-														/*
-														 * Configure OC1A as Output PIN
-														 * the pin where the PWM signal is generated from MC
-														 */
-														OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-														/*
-														 * Configure FOC1B bit in the TCCR1 register to be low
-														 * As Timer1 is PWM
-														 * Make FOC1B to be low as it is FAST_PWM_10bit mode
-														 */
-														TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-														/*
-														 * Configure compare output mode to work with Timer1
-														 * with one mode from 4 modes in TCCR1A
-														 * Configure COM1B0/COM1B1 bits in TCCR1A register
-														 */
-														TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-																((Timer1_config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM1B_SHIFT_VALUE);
-
-														/*
-														 * Configure Compare match value for Timer1 to start count from it
-														 * Anding with 0XFFFF to make sure the value won't exceed
-														 * OXFFFF as it is 16-bit Timer
-														 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-														 */
-														TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-														TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-														break;/*End of channel B*/
-													}/*End of Channel Type switch case*/
-													break;/*End of PWM_PhaseCorrect_OCR1A mode*/
-													/**************************************************************************
-													 *                          Timer1_CTC_ICR1_Mode
-													 * ************************************************************************/
-												case CTC_ICR1:
-													/*
-													 * Configure wave form generation mode to work with CTC_ICR1 mode
-													 * Set WMG10 bit in TCCR1A register
-													 * Set WMG11 bit in TCCR1A register
-													 */
-													TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-													TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-													/*
-													 * Configure wave form generation mode to work with CTC_ICR1 mode
-													 * Set WMG13 bit in TCCR1B register
-													 * Set WMG12 bit in TCCR1B register
-													 */
-													TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-													TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-													/*
-													 * Configure Input capture value for Timer1 to be the top from it
-													 * Anding with 0XFFFF to make sure the value won't exceed
-													 * OXFFFF as it is 16-bit Timer
-													 */
-													TIMER1_INPUT_CAPTURE_REGISTER  = ( (Timer1_config_PTR->timer1_InputCaptureValue) & 0XFFFF) ;
-
-													switch(Timer1_config_PTR->channel)
-													{
-
-													case ChannelA:
-
-														/*
-														 * Configure FOC1A bit in the TCCR1 register to be active
-														 * As Timer1 is non-PWM
-														 * Make FOC1A to be Active as it is compare mode
-														 */
-														TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-														/*
-														 * Configure compare output mode to work with Timer1
-														 * with one mode from 4 modes in TCCR1A
-														 * Configure COM1A0/COM1A1 bits in TCCR1A register
-														 */
-														TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-																((Timer1_config_PTR->Compare_Mode_NonPWM)<<COM1A_SHIFT_VALUE);
-														/*
-														 * Configure Compare match value for Timer1 to start count from it
-														 * Anding with 0XFFFF to make sure the value won't exceed
-														 * OXFFFF as it is 16-bit Timer
-														 */
-														TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-														/*
-														 * Enable Timer1 compare match interrupt
-														 * wait for: -Enable I-bit "mask bit" in the SREG register
-														 *           -OCF1 bit in the TIFR register to be set
-														 * Timer1 compare match mode is ready to work after that
-														 */
-														TIMER1_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER,TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_A);
-
-														break; /*End of channel A*/
-
-													case ChannelB:
-
-														/*
-														 * Configure FOC1B bit in the TCCR1 register to be active
-														 * As Timer1 is non-PWM
-														 * Make FOC1B to be Active as it is compare mode
-														 */
-														TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-														/*
-														 * Configure compare output mode to work with Timer1
-														 * with one mode from 4 modes in TCCR1A
-														 * Configure COM1B0/COM1B1 bits in TCCR1A register
-														 */
-														TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-																((Timer1_config_PTR->Compare_Mode_NonPWM)<<COM1B_SHIFT_VALUE);
-
-														/*
-														 * Configure Compare match value for Timer1 to start count from it
-														 * Anding with 0XFFFF to make sure the value won't exceed
-														 * OXFFFF as it is 16-bit Timer
-														 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-														 */
-														TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-														TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-														/*
-														 * Enable Timer1 compare match interrupt
-														 * wait for: -Enable I-bit "mask bit" in the SREG register
-														 *           -OCF1 bit in the TIFR register to be set
-														 * Timer1 compare match mode is ready to work after that
-														 */
-														TIMER1_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER,TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_B);
-
-														break;/*End of channel B*/
-													}/*End of Channel Type switch case*/
-
-													break;/*End of CTC_ICR1 mode*/
-
-													/**************************************************************************
-													 *                              Timer1_Reserved_Mode
-													 * ************************************************************************/
-													case Reserved_Mode:
-														break;
-													/**************************************************************************
-													 *                       Timer1_FAST_PWM_ICR1_Mode
-													 * ************************************************************************/
-												case FAST_PWM_ICR1:
-													/*
-													 * Configure wave form generation mode to work with PWM_PhaseCorrect_ICR1 mode
-													 * Clear WGM10 bit in TCCR1A register
-													 * Set WGM11 bit in TCCR1A register
-													 */
-													TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-													TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-													/*
-													 * Configure wave form generation mode to work with FAST_PWM_ICR1 mode
-													 * Set WGM12 bit in TCCR1B register
-													 * Set WMG13 bit in TCCR1B register
-													 */
-													TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-													TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-													/*
-													 * Configure Input capture value for Timer1 to be the top from it
-													 * Anding with 0XFFFF to make sure the value won't exceed
-													 * OXFFFF as it is 16-bit Timer
-													 */
-													TIMER1_INPUT_CAPTURE_REGISTER  = ( (Timer1_config_PTR->timer1_InputCaptureValue) & 0XFFFF) ;
-
-													switch(Timer1_config_PTR->channel)
-													{
-
-													case ChannelA:
-														/*
-														 * Configure OC1A as Output PIN
-														 * the pin where the PWM signal is generated from MC
-														 */
-														OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-														/*
-														 * Configure FOC1A bit in the TCCR1 register to be low
-														 * As Timer1 is PWM mode
-														 * Make FOC1A to be low as it is FAST_PWM_ICR1 mode
-														 */
-														TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-														/*
-														 * Configure compare output mode to work with Timer1
-														 * with one mode from 4 modes in TCCR1A
-														 * Configure COM1A0/COM1A1 bits in TCCR1A register
-														 */
-														TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-																((Timer1_config_PTR->Compare_Mode_FASTPWM)<<COM1A_SHIFT_VALUE);
-														/*
-														 * Configure Compare match value for Timer1 to start count from it
-														 * Anding with 0XFFFF to make sure the value won't exceed
-														 * OXFFFF as it is 16-bit Timer
-														 */
-														TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-														break; /*End of channel A*/
-
-													case ChannelB:
-														/*
-														 * Configure OC1A as Output PIN
-														 * the pin where the PWM signal is generated from MC
-														 */
-														OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-														/*
-														 * Configure FOC1B bit in the TCCR1 register to be low
-														 * As Timer1 is PWM
-														 * Make FOC1B to be low as it is FAST_PWM_ICR1 mode
-														 */
-														TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-														/*
-														 * Configure compare output mode to work with Timer1
-														 * with one mode from 4 modes in TCCR1A
-														 * Configure COM1B0/COM1B1 bits in TCCR1A register
-														 */
-														TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-																((Timer1_config_PTR->Compare_Mode_FASTPWM)<<COM1B_SHIFT_VALUE);
-
-														/*
-														 * Configure Compare match value for Timer1 to start count from it
-														 * Anding with 0XFFFF to make sure the value won't exceed
-														 * OXFFFF as it is 16-bit Timer
-														 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-														 */
-														TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-														TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-														break;/*End of channel B*/
-													}/*End of Channel Type switch case*/
-													break;/*End of FAST_PWM_ICR1 mode*/
-													/**************************************************************************
-													 *                       Timer1_FAST_PWM_OCR1A_Mode
-													 * ************************************************************************/
-												case FAST_PWM_OCR1A:
-													/*
-													 * Configure wave form generation mode to work with FAST_PWM_OCR1A mode
-													 * Set WGM10 bit in TCCR1A register
-													 * Set WGM11 bit in TCCR1A register
-													 */
-													TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT10);
-													TIMER1_CONTROL_REGIRSTER_A =  SET_BIT(TIMER1_CONTROL_REGIRSTER_A, TIMER1_WAVE_FORM_GENERATION_BIT11);
-
-													/*
-													 * Configure wave form generation mode to work with PWM_PhaseCorrect_ICR1 mode
-													 * Set WGM12 bit in TCCR1B register
-													 * Set WMG13 bit in TCCR1B register
-													 */
-													TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT12);
-													TIMER1_CONTROL_REGIRSTER_B =  SET_BIT(TIMER1_CONTROL_REGIRSTER_B, TIMER1_WAVE_FORM_GENERATION_BIT13);
-
-													switch(Timer1_config_PTR->channel)
-													{
-
-													case ChannelA:
-														/*
-														 * Configure OC1A as Output PIN
-														 * the pin where the PWM signal is generated from MC
-														 */
-														OC1A_DIRECTION_PORT = SET_BIT(OC1A_DIRECTION_PORT, OC1A_PIN);
-
-														/*
-														 * Configure FOC1A bit in the TCCR1 register to be low
-														 * As Timer1 is PWM mode
-														 * Make FOC1A to be low as it is FAST_PWM_OCR1A mode
-														 */
-														TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_A);
-														/*
-														 * Configure compare output mode to work with Timer1
-														 * with one mode from 4 modes in TCCR1A
-														 * Configure COM1A0/COM1A1 bits in TCCR1A register
-														 */
-														TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1A_MASK_CLEAR) |
-																((Timer1_config_PTR->Compare_Mode_FASTPWM)<<COM1A_SHIFT_VALUE);
-														/*
-														 * Configure Compare match value for Timer1 to start count from it
-														 * Anding with 0XFFFF to make sure the value won't exceed
-														 * OXFFFF as it is 16-bit Timer
-														 */
-														TIMER1_OUTPUT_COMPARE_REGISTER_A = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-														break; /*End of channel A*/
-
-													case ChannelB:
-														/*
-														 * Configure OC1A as Output PIN
-														 * the pin where the PWM signal is generated from MC
-														 */
-														OC1B_DIRECTION_PORT = SET_BIT(OC1B_DIRECTION_PORT, OC1B_PIN);
-
-														/*
-														 * Configure FOC1B bit in the TCCR1 register to be low
-														 * As Timer1 is PWM
-														 * Make FOC1B to be low as it is FAST_PWM_OCR1A mode
-														 */
-														TIMER1_CONTROL_REGIRSTER_A =  CLEAR_BIT(TIMER1_CONTROL_REGIRSTER_A,TIMER1_FORCE_OUTPUT_COMPARE_BIT_B);
-
-														/*
-														 * Configure compare output mode to work with Timer1
-														 * with one mode from 4 modes in TCCR1A
-														 * Configure COM1B0/COM1B1 bits in TCCR1A register
-														 */
-														TIMER1_CONTROL_REGIRSTER_A = (TIMER1_CONTROL_REGIRSTER_A & TIMER1_COM1B_MASK_CLEAR) |
-																((Timer1_config_PTR->Compare_Mode_FASTPWM)<<COM1B_SHIFT_VALUE);
-
-														/*
-														 * Configure Compare match value for Timer1 to start count from it
-														 * Anding with 0XFFFF to make sure the value won't exceed
-														 * OXFFFF as it is 16-bit Timer
-														 * to make it count right put OCR1A  greater than the value in OCR1B by 1
-														 */
-														TIMER1_OUTPUT_COMPARE_REGISTER_A = (((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF) + 1;
-														TIMER1_OUTPUT_COMPARE_REGISTER_B = ((Timer1_config_PTR->timer1_compare_MatchValue)) & 0XFFFF;
-
-														break;/*End of channel B*/
-													}/*End of Channel Type switch case*/
-													break;/*End of FAST_PWM_OCR1A mode*/
-	}/*End of switch case timer1_mode*/
+		if(descriptor & MODE_COMPARE_VALUE)
+		{
+			TIMER1_OUTPUT_COMPARE_REGISTER_A = Timer1_config_PTR->timer1_compare_MatchValue + 1;
+			TIMER1_OUTPUT_COMPARE_REGISTER_B = Timer1_config_PTR->timer1_compare_MatchValue;
+		}
+		break;/*End of channel B*/
+	}/*End of Channel Type*/
+
+	/*
+	 * Restart the timestamp, it is extended by the interrupt of the period end
+	 */
+	Timer1_setTimestampScale(Timer1_config_PTR->timer1_clock);
+	g_Timer1_elapsedCounts = 0;
+	g_Timer1_elapsedMillis = 0;
+	g_Timer1_millisCounts = 0;
+	if(mode == Normal)
+	{
+		g_Timer1_timestampSource = TIMESTAMP_OVERFLOW;
+	}
+	else if(mode == CTC_OCR1A)
+	{
+		g_Timer1_timestampSource = TIMESTAMP_COMPARE_A;
+	}
+	else
+	{
+		g_Timer1_timestampSource = TIMESTAMP_NONE;
+	}
+
+	/*
+	 * Write TCCR1A then TCCR1B with WGM13:12 (high 2-bits of the mode number)
+	 * and the Clock Pre-scaler value, this write starts the timer
+	 */
+	TIMER1_CONTROL_REGIRSTER_A = controlA;
+	TIMER1_CONTROL_REGIRSTER_B = (TIMER1_CONTROL_REGIRSTER_B & TCCR1B_WGM_CLOCK_MASK_CLEAR) |
+			(uint8)((mode >> WGM_16BIT_HIGH_SHIFT) << WGM12_BIT) |
+			((Timer1_config_PTR->timer1_clock) & ~TIMER1_CLOCK_MASK_CLEAR);
+
+	/*
+	 * Enable Timer1 overflow or compare match interrupt of the channel
+	 * wait for: -Enable I-bit "mask bit" in the SREG register
+	 */
+	if(descriptor & MODE_OVERFLOW_INTERRUPT)
+	{
+		TIMER1_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER, TIMER1_OUTPUT_OVERFLOW_INTERRUPT);
+	}
+	if(descriptor & MODE_COMPARE_INTERRUPT)
+	{
+		if(Timer1_config_PTR->channel == ChannelA)
+		{
+			TIMER1_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER, TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_A);
+		}
+		else
+		{
+			TIMER1_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER1_INTERRUPT_MASK_REGISTER, TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_B);
+		}
+	}
 }/*End of Timer1_Init function */
 
 /***************************************************************************************************
@@ -1814,7 +809,12 @@ void Timer1_Init(const Timer1_ConfigType* Timer1_config_PTR)
  ***************************************************************************************************/
 void Timer1_setCallBack( void(*a_ptr)(void) )
 {
-	g_Timer1_callBackPtr = a_ptr;
+	/*
+	 * Same call back for the overflow and the compare interrupts of channel A & B
+	 */
+	IsrDispatch_setCallBack(&g_Timer_subscribers[Timer1_OVF_Vector], a_ptr);
+	IsrDispatch_setCallBack(&g_Timer_subscribers[Timer1_COMPA_Vector], a_ptr);
+	IsrDispatch_setCallBack(&g_Timer_subscribers[Timer1_COMPB_Vector], a_ptr);
 }
 /***************************************************************************************************
  * [Function Name]: Timer1_DeInit
@@ -1843,6 +843,15 @@ void Timer1_DeInit(void)
 	TIMER1_INTERRUPT_MASK_REGISTER     &= 0X00;
 	TIMER1_INPUT_CAPTURE_REGISTER      &= 0X00;
 
+	/*Disable the fractional compare match*/
+	g_Timer1_fractionDenominator = 0;
+
+	/*Stop the timestamp*/
+	g_Timer1_timestampSource = TIMESTAMP_NONE;
+	g_Timer1_elapsedCounts = 0;
+	g_Timer1_elapsedMillis = 0;
+	g_Timer1_millisCounts = 0;
+
 }/*End of Timer0_DEInit*/
 
 
@@ -1893,6 +902,11 @@ void Timer1_Start(Timer_Clock timer1_clock_value)
 	 * timer1 will stop incrementing
 	 */
 	TIMER1_CONTROL_REGIRSTER_B  =  (TIMER1_CONTROL_REGIRSTER_B  & TIMER1_CLOCK_MASK_CLEAR) | timer1_clock_value;
+
+	/*
+	 * The timestamp keeps counting with the new clock
+	 */
+	Timer1_setTimestampScale(timer1_clock_value);
 }
 /***************************************************************************************************
  * [Function Name]: Timer1_Change_CompareMatchValue
@@ -1932,217 +946,186 @@ void Timer1_Change_CompareMatchValue(uint16 timer1_newCompareValue, Channel_Type
 	}/*End of switch case*/
 
 }
-
-
-/**************************************************************************
- *                              Timer2                                    *
- **************************************************************************/
 /***************************************************************************************************
- * [Function Name]: Timer2_init
+ * [Function Name]: Timer1_setFractionalCompare
  *
- * [Description]:  Function to Initialize Timer2 Driver
- *                 - Working in Interrupt Mode
- *                 - Choose Timer0 initial value
- *                 - Choose Timer_Mode (OverFlow,PWM_PhaseCoorect ,CTC, FAST_PWM)
- *                 - Choose Timer compare match value if using CTC mode
- *                 - Choose Timer_Clock
+ * [Description]:  Function to make Timer1 CTC_OCR1A mode generate a period which is not
+ *                 a whole number of timer counts without long run drift
+ *                 - The period is (base + remainder/denominator) timer counts
+ *                 - Every period is base or base+1 counts, OCR1A is updated in the
+ *                   compare match interrupt and the error never exceeds one count
  *
+ * [Args]:         base, remainder, denominator
  *
- * [Args]:         config_PTR
- *
- * [In]            Config_Ptr: Pointer to Timer Configuration Structure
+ * [In]            base: Whole timer counts of the period
+ *                 remainder: Numerator of the fraction of a count, less than denominator
+ *                 denominator: Denominator of the fraction of a count, 0 to disable
+ *                              (for a period of T seconds use F_CPU*T/prescaler as
+ *                              base + remainder/prescaler)
  *
  * [Out]           NONE
  *
  * [Returns]:      NONE
  ***************************************************************************************************/
-void Timer2_Init(const Timer2_ConfigType* config_PTR)
+void Timer1_setFractionalCompare(uint16 base, uint16 remainder, uint16 denominator)
 {
+	uint8 sreg = SREG_REG;
 
 	/*
-	 * Configure initial value for Timer2 to start count from it
-	 * Anding with 0XFF to make sure the value won't exceed
-	 * 255 as it is 8-bit Timer
+	 * Update the parameters with the interrupts disabled so
+	 * the compare match interrupt never sees half of them
 	 */
-
-	TIMER2_CONTROL_REGIRSTER = ( (config_PTR->timer2_InitialValue) ) & 0XFF;
+	SREG_REG = CLEAR_BIT(SREG_REG, I_BIT);
+	g_Timer1_fractionBase = base;
+	g_Timer1_fractionRemainder = remainder;
+	g_Timer1_fractionDenominator = denominator;
 
 	/*
-	 * Configure Clock Pre-scaler value for Timer2 in TCCR2 Register
-	 * Anding with 0XF8 to make sure the first 3-bits in TCCR2 register=0
-	 * ORing with the selected timer clock to include it in the first 3-bits
-	 * and keep the other bits as they are
+	 * The first period is base counts, the accumulator already carries
+	 * its fraction so the time counted is never a full count late
 	 */
+	g_Timer1_fractionAccumulator = remainder;
+	TIMER1_OUTPUT_COMPARE_REGISTER_A = base - 1;
+	SREG_REG = sreg;
+}
+/***************************************************************************************************
+ * [Function Name]: Timer1_restartPeriod
+ *
+ * [Description]:  Function to start a new compare period of Timer1 now, so the next compare
+ *                 match A comes one full period later, a pending match is dropped and the
+ *                 fractional compare starts again, the timestamp keeps counting
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer1_restartPeriod(void)
+{
+	uint8 sreg = SREG_REG;
+	uint16 counts;
+	uint8 low;
 
-	TIMER2_CONTROL_REGIRSTER = (TIMER2_CONTROL_REGIRSTER  & TIMER2_CLOCK_MASK_CLEAR) |
-			(config_PTR->timer2_clock);
+	SREG_REG = CLEAR_BIT(SREG_REG, I_BIT);
 
+	/*
+	 * Keep the counts of the period cut short in the timestamp
+	 */
+	low = TIMER1_INITIAL_VALUE_LOW_REGISTER;
+	counts = ((uint16)TIMER1_INITIAL_VALUE_HIGH_REGISTER << 8) | low;
 
-	switch ( (config_PTR->timer2_mode) )
+	/*
+	 * The period may have ended after the interrupts were disabled, add it
+	 * and read TCNT1 again to be sure it is a count of the new period, as
+	 * Timer1_getCounts does
+	 */
+	if((g_Timer1_timestampSource == TIMESTAMP_COMPARE_A) &&
+			BIT_IS_SET(TIMER1_INTERRUPT_FLAG_REGISTER, TIMER1_OUTPUT_COMPARE_A_MATCH_FLAG))
 	{
+		TIMER1_ADD_ELAPSED_COUNTS((uint32)TIMER1_OUTPUT_COMPARE_REGISTER_A + 1);
+		low = TIMER1_INITIAL_VALUE_LOW_REGISTER;
+		counts = ((uint16)TIMER1_INITIAL_VALUE_HIGH_REGISTER << 8) | low;
+	}
+	TIMER1_ADD_ELAPSED_COUNTS(counts);
 
-	case Overflow:
+	/*
+	 * Clear the counter and the pre-scaler (shared with Timer0, which
+	 * loses less than one of its pre-scaled counts)
+	 */
+	TIMER1_INITIAL_VALUE_REGISTER = 0;
+	TIMER1_PRESCALER_RESET_REGISTER = SET_BIT(TIMER1_PRESCALER_RESET_REGISTER, TIMER1_PRESCALER_RESET_BIT);
 
+	if(g_Timer1_fractionDenominator != 0)
+	{
 		/*
-		 * Configure wave form generation mode to work with normal mode
-		 * Clear WGM20 bit in TCCR2 register
-		 * Clear WGM21 bit in TCCR0 register
+		 * The first period is base counts and carries its fraction
 		 */
-		TIMER2_CONTROL_REGIRSTER  = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER , TIMER2_WAVE_FORM_GENERATION_BIT0);
-		TIMER2_CONTROL_REGIRSTER  = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER , TIMER2_WAVE_FORM_GENERATION_BIT1);
+		g_Timer1_fractionAccumulator = g_Timer1_fractionRemainder;
+		TIMER1_OUTPUT_COMPARE_REGISTER_A = g_Timer1_fractionBase - 1;
+	}
 
-		/*
-		 * Configure compare output mode to work with normal port operation
-		 * Decide the mode of OC2 from compare output modes with non PWM
-		 * Configure COM20 bit in TCCR2 register
-		 * Configure COM21 bit in TCCR2 register
-		 */
-		TIMER2_CONTROL_REGIRSTER = (TIMER2_CONTROL_REGIRSTER & TIMER2_COM2_MASK_CLEAR ) |
-				((config_PTR->Compare_Mode_NonPWM)<<COM2_SHIFT_VALUE);
+	/*
+	 * Drop the compare match which may have come before the restart
+	 */
+	TIMER1_INTERRUPT_FLAG_REGISTER = (1<<TIMER1_OUTPUT_COMPARE_A_MATCH_FLAG);
 
-		/*
-		 * Configure FOC2 bit in the TCCR2 register to be active
-		 * As Timer2 is non-PWM
-		 * Make FOC2 to be Active as it is overflow mode
-		 */
-		TIMER2_CONTROL_REGIRSTER = SET_BIT(TIMER2_CONTROL_REGIRSTER,TIMER2_FORCE_OUTPUT_COMPARE_BIT);
+	SREG_REG = sreg;
+}
 
-		/*
-		 * Enable Timer2 overflow interrupt
-		 * wait for: -Enable I-bit "mask bit" in the SREG register
-		 *           -TOV2 bit in the TIFR register to be set
-		 * Timer2 overflow mode is ready to work after that
-		 */
-		TIMER2_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER2_INTERRUPT_MASK_REGISTER, TIMER2_OUTPUT_OVERFLOW_INTERRUPT);
-		break;
 
+/**************************************************************************
+ *                              Timer2                                    *
+ **************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: Timer2_init
+ *
+ * [Description]:  Function to Initialize Timer2 Driver
+ *                 - Working in Interrupt Mode
+ *                 - Choose Timer0 initial value
+ *                 - Choose Timer_Mode (OverFlow,PWM_PhaseCoorect ,CTC, FAST_PWM)
+ *                 - Choose Timer compare match value if using CTC mode
+ *                 - Choose Timer_Clock
+ *
+ *
+ * [Args]:         config_PTR
+ *
+ * [In]            Config_Ptr: Pointer to Timer Configuration Structure
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer2_Init(const Timer2_ConfigType* config_PTR)
+{
+	uint8 mode = (uint8)(config_PTR->timer2_mode);
+	uint8 descriptor = pgm_read_byte(&g_Timer_8bitModes[mode]);
+	uint8 compareMode = Timer_selectCompareMode(descriptor, config_PTR->Compare_Mode_NonPWM,
+			config_PTR->Compare_Mode_PWM_PhaseCorrect, config_PTR->Compare_Mode_FASTPWM);
 
-	case PWM_PhaseCorrect:
+	/*
+	 * Configure initial value for Timer2 to start count from it
+	 */
+	TIMER2_INITIAL_VALUE_REGISTER = config_PTR->timer2_InitialValue;
 
-		/*
-		 * Configure OC2 as Output PIN
-		 * the pin where the PWM signal is generated from MC
-		 */
+	/*
+	 * Configure Compare match value for Timer2 before the clock starts
+	 */
+	if(descriptor & MODE_COMPARE_VALUE)
+	{
+		TIMER2_OUTPUT_COMPARE_REGISTER = config_PTR->timer2_compare_MatchValue;
+	}
 
+	/*
+	 * Configure OC2 as Output PIN in the PWM modes
+	 * the pin where the PWM signal is generated from MC
+	 */
+	if((descriptor & MODE_OUTPUT_MASK) != MODE_OUTPUT_NON_PWM)
+	{
 		OC2_DIRECTION_PORT = SET_BIT(OC2_DIRECTION_PORT, OC2_PIN);
+	}
 
-		/*
-		 *Clear force output compare bit in Timer/Counter control register
-		 *to work with pulse width modulation
-		 */
-		TIMER2_CONTROL_REGIRSTER = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_FORCE_OUTPUT_COMPARE_BIT);
-
-		/*
-		 * Configure wave form generation mode to work with PWM_PhaseCorrect mode
-		 * SET WGM20 bit in TCCR0 register
-		 * Clear WGM21 bit in TCCR0 register
-		 */
-		TIMER2_CONTROL_REGIRSTER = SET_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_WAVE_FORM_GENERATION_BIT0);
-		TIMER2_CONTROL_REGIRSTER = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_WAVE_FORM_GENERATION_BIT1);
-
-		/*
-		 * Configure compare output mode to work with normal port operation
-		 * Decide the mode of OC2 from compare output modes with PWM_PhaseCorrect
-		 * Configure COM20 bit in TCCR2 register
-		 * Configure COM21 bit in TCCR2 register
-		 */
-		TIMER2_CONTROL_REGIRSTER = (TIMER2_CONTROL_REGIRSTER & TIMER2_COM2_MASK_CLEAR ) |
-				((config_PTR->Compare_Mode_PWM_PhaseCorrect)<<COM2_SHIFT_VALUE);
-
-		/*
-		 * Configure Compare match value for Timer2 to start count till reach it
-		 * Anding with 0XFF to make sure the value won't exceed
-		 * 255 as it is 8-bit Timer
-		 */
-		TIMER2_OUTPUT_COMPARE_REGISTER = ((config_PTR->timer2_compare_MatchValue)) & 0XFF;
-
-		break; /*End of PWM_PhaseCorrect*/
-
-
-	case CTC:
-
-		/*
-		 * Configure wave form generation mode to work with CTC mode
-		 * Clear WGM20 bit in TCCR2 register
-		 * Clear WGM21 bit in TCCR2 register
-		 */
-		TIMER2_CONTROL_REGIRSTER = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_WAVE_FORM_GENERATION_BIT0);
-		TIMER2_CONTROL_REGIRSTER = SET_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_WAVE_FORM_GENERATION_BIT1);
-
-		/*
-		 * Configure compare output mode to work with normal port operation
-		 * Decide the mode of OC0 from compare output modes with non PWM
-		 * Configure COM20 bit in TCCR0 register
-		 * Configure COM21 bit in TCCR0 register
-		 */
-		TIMER2_CONTROL_REGIRSTER = (TIMER2_CONTROL_REGIRSTER & TIMER2_COM2_MASK_CLEAR ) |
-				((config_PTR->Compare_Mode_NonPWM)<<COM2_SHIFT_VALUE);
-
-		/*
-		 * Configure FOC0 bit in the TCCR2 register to be active
-		 * As Timer2 is non-PWM
-		 * Make FOC2 to be Active as it is compare mode
-		 */
-		TIMER2_CONTROL_REGIRSTER = SET_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_FORCE_OUTPUT_COMPARE_BIT);
-
-		/*
-		 * Configure Compare match value for Timer2 to start count from it
-		 * Anding with 0XFF to make sure the value won't exceed
-		 * 255 as it is 8-bit Timer
-		 */
-		TIMER2_OUTPUT_COMPARE_REGISTER = ((config_PTR->timer2_compare_MatchValue)) & 0XFF;
+	/*
+	 * TCCR2 has the same layout as TCCR0, configure wave form generation mode,
+	 * compare output mode, FOC2 and Clock Pre-scaler value in one write
+	 */
+	TIMER2_CONTROL_REGIRSTER = Timer_8bitControlValue(mode, descriptor, compareMode) |
+			((config_PTR->timer2_clock) & ~TIMER2_CLOCK_MASK_CLEAR);
 
-		/*
-		 * Enable Timer0 compare match interrupt
-		 * wait for: -Enable I-bit "mask bit" in the SREG register
-		 *           -OCF0 bit in the TIFR register to be set
-		 * Timer0 compare match mode is ready to work after that
-		 */
+	/*
+	 * Enable Timer2 overflow or compare match interrupt
+	 * wait for: -Enable I-bit "mask bit" in the SREG register
+	 */
+	if(descriptor & MODE_OVERFLOW_INTERRUPT)
+	{
+		TIMER2_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER2_INTERRUPT_MASK_REGISTER, TIMER2_OUTPUT_OVERFLOW_INTERRUPT);
+	}
+	if(descriptor & MODE_COMPARE_INTERRUPT)
+	{
 		TIMER2_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER2_INTERRUPT_MASK_REGISTER, TIMER2_OUTPUT_COMPARE_MATCH_INTERRUPT);
-
-		break; /*End of compare mode*/
-
-	case FAST_PWM:
-		/*
-		 * Configure OC2 as Output PIN
-		 * the pin where the PWM signal is generated from MC
-		 */
-
-		OC2_DIRECTION_PORT = SET_BIT(OC2_DIRECTION_PORT, OC2_PIN);
-
-		/*
-		 *Clear force output compare bit in Timer/Counter control register
-		 *to work with pulse width modulation
-		 */
-		TIMER2_CONTROL_REGIRSTER = CLEAR_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_FORCE_OUTPUT_COMPARE_BIT);
-
-		/*
-		 * Configure wave form generation mode to work with FAST PWM mode
-		 * SET WGM20 bit in TCCR2 register
-		 * SET WGM21 bit in TCCR2 register
-		 */
-		TIMER2_CONTROL_REGIRSTER = SET_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_WAVE_FORM_GENERATION_BIT0);
-		TIMER2_CONTROL_REGIRSTER = SET_BIT(TIMER2_CONTROL_REGIRSTER, TIMER2_WAVE_FORM_GENERATION_BIT1);
-
-		/*
-		 * Configure compare output mode to work with normal port operation
-		 * Decide the mode of OC2 from compare output modes with non PWM
-		 * Configure COM20 bit in TCCR2 register
-		 * Configure COM21 bit in TCCR2 register
-		 */
-		TIMER2_CONTROL_REGIRSTER = (TIMER2_CONTROL_REGIRSTER & TIMER2_COM2_MASK_CLEAR ) |
-				((config_PTR->Compare_Mode_FASTPWM)<<COM2_SHIFT_VALUE);
-
-		/*
-		 * Configure Compare match value for Timer2 to start count till reach it
-		 * Anding with 0XFF to make sure the value won't exceed
-		 * 255 as it is 8-bit Timer
-		 */
-		TIMER2_OUTPUT_COMPARE_REGISTER = ((config_PTR->timer2_compare_MatchValue)) & 0XFF;
-
-		break;/*End of Fast PWM*/
-
-	}/*End of switch case for timer2_mode*/
+	}
 
 }/*End of Timer2_Init*/
 
@@ -2164,7 +1147,11 @@ void Timer2_Init(const Timer2_ConfigType* config_PTR)
  ***************************************************************************************************/
 void Timer2_setCallBack( void(*a_ptr)(void) )
 {
-	g_Timer2_callBackPtr = a_ptr;
+	/*
+	 * Same call back for the overflow and the compare interrupts
+	 */
+	IsrDispatch_setCallBack(&g_Timer_subscribers[Timer2_OVF_Vector], a_ptr);
+	IsrDispatch_setCallBack(&g_Timer_subscribers[Timer2_COMP_Vector], a_ptr);
 }
 /***************************************************************************************************
  * [Function Name]: Timer2_DeInit
@@ -2222,14 +1209,14 @@ void Timer2_Stop(void)
  * [Args]:        timer2_clock_value
  *
  *
- * [In]           timer2_clock_value:  -Variable from type enum Timer_Clock
+ * [In]           timer2_clock_value:  -Variable from type enum Timer2_Clock
  *                                     -To use it to choose the clock of the timer
  *
  * [Out]           NONE
  *
  * [Returns]:      NONE
  ***************************************************************************************************/
-void Timer2_Start(Timer_Clock timer2_clock_value)
+void Timer2_Start(Timer2_Clock timer2_clock_value)
 {
 	/*
 	 * Clear the first 3-bits in TCCR0 register
@@ -2261,5 +1248,425 @@ void Timer2_Change_CompareMatchValue(uint8 timer2_newCompareValue)
 	TIMER2_OUTPUT_COMPARE_REGISTER = (TIMER2_OUTPUT_COMPARE_REGISTER & 0X00) |
 			(timer2_newCompareValue & 0XFF);
 }
-/****************************************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: Timer2_RTC_Init
+ *
+ * [Description]:  Function to Initialize Timer2 as a real time clock
+ *                 - Clocked asynchronously from a 32.768KHz watch crystal on TOSC1/TOSC2
+ *                 - Overflow interrupt every 1 second, the Timer2 call back is called
+ *                 - Keeps counting in the power-save sleep mode
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer2_RTC_Init(void)
+{
+	/*
+	 * Disable Timer2 interrupts while the clock source is changed
+	 */
+	TIMER2_INTERRUPT_MASK_REGISTER = CLEAR_BIT(TIMER2_INTERRUPT_MASK_REGISTER, TIMER2_OUTPUT_OVERFLOW_INTERRUPT);
+	TIMER2_INTERRUPT_MASK_REGISTER = CLEAR_BIT(TIMER2_INTERRUPT_MASK_REGISTER, TIMER2_OUTPUT_COMPARE_MATCH_INTERRUPT);
+
+	/*
+	 * Clock Timer2 from the crystal on TOSC1/TOSC2 instead of the CPU clock
+	 */
+	TIMER2_ASYNC_STATUS_REGISTER = SET_BIT(TIMER2_ASYNC_STATUS_REGISTER, TIMER2_ASYNC_CLOCK_BIT);
+
+	/*
+	 * Normal mode, OC2 disconnected, clock/128 --> overflow every 1 second
+	 */
+	TIMER2_INITIAL_VALUE_REGISTER  = 0X00;
+	TIMER2_OUTPUT_COMPARE_REGISTER = 0X00;
+	TIMER2_CONTROL_REGIRSTER       = TIMER2_RTC_CLOCK_128;
+
+	/*
+	 * The registers are written through the asynchronous clock domain,
+	 * wait until TCNT2, OCR2 and TCCR2 are updated
+	 */
+	while(TIMER2_ASYNC_STATUS_REGISTER & TIMER2_ASYNC_UPDATE_BUSY_MASK);
+
+	/*
+	 * Clear the flags which may be corrupted by the clock switch
+	 * then enable Timer2 overflow interrupt
+	 */
+	TIMER2_INTERRUPT_FLAG_REGISTER = (1<<TIMER2_OVERFLOW_FLAG) | (1<<TIMER2_COMPARE_FLAG);
+	TIMER2_INTERRUPT_MASK_REGISTER = SET_BIT(TIMER2_INTERRUPT_MASK_REGISTER, TIMER2_OUTPUT_OVERFLOW_INTERRUPT);
+}
+/***************************************************************************************************
+ * [Function Name]: Timer2_RTC_Start
+ *
+ * [Description]:  Function to restart the clock of Timer2 in RTC mode after Timer2_Stop
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer2_RTC_Start(void)
+{
+	TIMER2_CONTROL_REGIRSTER = (TIMER2_CONTROL_REGIRSTER  & TIMER2_CLOCK_MASK_CLEAR) | TIMER2_RTC_CLOCK_128;
 
+	/*
+	 * wait until TCCR2 is updated in the asynchronous clock domain
+	 */
+	while(BIT_IS_SET(TIMER2_ASYNC_STATUS_REGISTER, TIMER2_CONTROL_UPDATE_BUSY_BIT));
+}
+/***************************************************************************************************
+ * [Function Name]: Timer2_RTC_restartPeriod
+ *
+ * [Description]:  Function to start a new overflow period of Timer2 in RTC mode now, so the
+ *                 next overflow comes one full period later and a pending overflow is dropped
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer2_RTC_restartPeriod(void)
+{
+	uint8 sreg = SREG_REG;
+
+	SREG_REG = CLEAR_BIT(SREG_REG, I_BIT);
+
+	/*
+	 * Clear the counter and the pre-scaler of the crystal clock, then
+	 * wait until the counter is updated in the asynchronous clock domain
+	 */
+	TIMER2_INITIAL_VALUE_REGISTER = 0X00;
+	TIMER2_PRESCALER_RESET_REGISTER = SET_BIT(TIMER2_PRESCALER_RESET_REGISTER, TIMER2_PRESCALER_RESET_BIT);
+	while(BIT_IS_SET(TIMER2_ASYNC_STATUS_REGISTER, TIMER2_COUNTER_UPDATE_BUSY_BIT));
+
+	/*
+	 * Drop the overflow which may have come before the restart
+	 */
+	TIMER2_INTERRUPT_FLAG_REGISTER = (1<<TIMER2_OVERFLOW_FLAG);
+
+	SREG_REG = sreg;
+}
+/***************************************************************************************************
+ * [Function Name]: Timer2_RTC_prepareSleep
+ *
+ * [Description]:  Function to call before entering power-save sleep in RTC mode, it makes
+ *                 sure one crystal cycle passed since the last wake up so the overflow
+ *                 interrupt logic is ready to wake the CPU again
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer2_RTC_prepareSleep(void)
+{
+	/*
+	 * Write the same value to OCR2 and wait for the update, this
+	 * takes at least one cycle of the asynchronous clock
+	 */
+	TIMER2_OUTPUT_COMPARE_REGISTER = TIMER2_OUTPUT_COMPARE_REGISTER;
+	while(BIT_IS_SET(TIMER2_ASYNC_STATUS_REGISTER, TIMER2_COMPARE_UPDATE_BUSY_BIT));
+}
+/**************************************************************************
+ *                             Period Solver                              *
+ * ************************************************************************/
+#if (TIMER_RUNTIME_SOLVER == TRUE)
+/***************************************************************************************************
+ * [Function Name]: Timer_solve
+ *
+ * [Description]:  Function to choose the pre-scaler and the compare value of a timer for a
+ *                 wanted period of numerator/denominator seconds
+ *
+ * [Args]:         timer, numerator, denominator, result_PTR
+ *
+ * [In]            timer:       Timer0_ID, Timer1_ID or Timer2_ID
+ *                 numerator:   Numerator of the period in seconds
+ *                 denominator: Denominator of the period in seconds
+ *
+ * [Out]           result_PTR: Clock, pre-scaler, compare value and the error in ppm
+ *
+ * [Returns]:      FALSE if no pre-scaler gives a count which fits the timer
+ ***************************************************************************************************/
+static bool Timer_solve(Timer_ID timer, uint32 numerator, uint32 denominator, Timer_PeriodType *result_PTR)
+{
+	const uint16 *prescalers = g_Timer_prescalers;
+	uint8 prescalersCount = sizeof(g_Timer_prescalers) / sizeof(g_Timer_prescalers[0]);
+	uint32 maximumCounts = TIMER0_MAXIMUM_COUNTS;
+	uint64 wanted = (uint64)F_CPU * numerator;
+	uint64 actual;
+	uint64 counts;
+	uint16 prescaler;
+	uint8 i;
+
+	if(denominator == 0)
+	{
+		return FALSE;
+	}
+
+	if(timer == Timer1_ID)
+	{
+		maximumCounts = TIMER1_MAXIMUM_COUNTS;
+	}
+	else if(timer == Timer2_ID)
+	{
+		prescalers = g_Timer2_prescalers;
+		prescalersCount = sizeof(g_Timer2_prescalers) / sizeof(g_Timer2_prescalers[0]);
+	}
+
+	for(i = 0; i < prescalersCount; i++)
+	{
+		prescaler = pgm_read_word(&prescalers[i]);
+
+		/*
+		 * Rounded number of timer counts of the period
+		 */
+		counts = (wanted + ((uint64)prescaler * denominator) / 2) / ((uint64)prescaler * denominator);
+
+		if((counts >= 1) && (counts <= maximumCounts))
+		{
+			actual = counts * prescaler * denominator;
+
+			result_PTR->clock = i + 1;
+			result_PTR->prescaler = prescaler;
+			result_PTR->compareValue = (uint16)(counts - 1);
+			result_PTR->errorPPM = (uint32)((((actual > wanted) ? (actual - wanted) : (wanted - actual)) * 1000000ULL) / wanted);
+			return TRUE;
+		}
+	}
+
+	return FALSE;
+}
+/***************************************************************************************************
+ * [Function Name]: Timer_solvePeriod
+ *
+ * [Description]:  Function to choose the pre-scaler and the CTC compare value of a timer
+ *                 for a wanted period, the smallest pre-scaler whose count fits the timer
+ *                 is chosen as it gives the finest resolution
+ *
+ * [Args]:         timer, period_us, result_PTR
+ *
+ * [In]            timer:     Timer0_ID, Timer1_ID or Timer2_ID
+ *                 period_us: Wanted period in micro seconds
+ *
+ * [Out]           result_PTR: Clock, pre-scaler, compare value and the error in ppm
+ *
+ * [Returns]:      FALSE if the period is too short or too long for the timer
+ ***************************************************************************************************/
+bool Timer_solvePeriod(Timer_ID timer, uint32 period_us, Timer_PeriodType *result_PTR)
+{
+	if(period_us == 0)
+	{
+		return FALSE;
+	}
+	return Timer_solve(timer, period_us, 1000000UL, result_PTR);
+}
+/***************************************************************************************************
+ * [Function Name]: Timer_solveFrequency
+ *
+ * [Description]:  Function to choose the pre-scaler and the CTC compare value of a timer
+ *                 for a wanted interrupt frequency, same as Timer_solvePeriod
+ *
+ * [Args]:         timer, frequency_hz, result_PTR
+ *
+ * [In]            timer:        Timer0_ID, Timer1_ID or Timer2_ID
+ *                 frequency_hz: Wanted frequency in Hz
+ *
+ * [Out]           result_PTR: Clock, pre-scaler, compare value and the error in ppm
+ *
+ * [Returns]:      FALSE if the frequency is too high or too low for the timer
+ ***************************************************************************************************/
+bool Timer_solveFrequency(Timer_ID timer, uint32 frequency_hz, Timer_PeriodType *result_PTR)
+{
+	return Timer_solve(timer, 1, frequency_hz, result_PTR);
+}
+#endif
+/**************************************************************************
+ *                           Vector Subscribers                           *
+ * ************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: Timer_subscribe
+ *
+ * [Description]:  Function to add a handler called from one timer interrupt vector, every
+ *                 vector has its own list of ISR_DISPATCH_MAX_SUBSCRIBERS handlers
+ *
+ * [Args]:         a_vector, a_handler, a_context
+ *
+ * [In]            a_vector:  Interrupt vector of the timer
+ *                 a_handler: Function called from the ISR with a_context
+ *                 a_context: Pointer passed back to the handler, may be NULL_PTR
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the vector is not valid or its list is full
+ ***************************************************************************************************/
+bool Timer_subscribe(Timer_VectorID a_vector, void (*a_handler)(void *a_context), void *a_context)
+{
+	if(a_vector >= TIMER_VECTORS)
+	{
+		return FALSE;
+	}
+
+	return IsrDispatch_subscribe(&g_Timer_subscribers[a_vector], a_handler, a_context);
+}
+/***************************************************************************************************
+ * [Function Name]: Timer_unsubscribe
+ *
+ * [Description]:  Function to remove a handler added by Timer_subscribe
+ *
+ * [Args]:         a_vector, a_handler, a_context
+ *
+ * [In]            a_vector:  Interrupt vector of the timer
+ *                 a_handler: Function given to Timer_subscribe
+ *                 a_context: Context given to Timer_subscribe
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer_unsubscribe(Timer_VectorID a_vector, void (*a_handler)(void *a_context), void *a_context)
+{
+	if(a_vector < TIMER_VECTORS)
+	{
+		IsrDispatch_unsubscribe(&g_Timer_subscribers[a_vector], a_handler, a_context);
+	}
+}
+/**************************************************************************
+ *                              Timestamp                                 *
+ * ************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: Timer1_getPendingCounts
+ *
+ * [Description]:  Function to read the Timer1 counts not added to the timestamp by the
+ *                 interrupt yet, called with the interrupts disabled
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      TCNT1, plus the period which ended if its interrupt is still pending
+ ***************************************************************************************************/
+static uint32 Timer1_getPendingCounts(void)
+{
+	uint32 pending = 0;
+	uint16 counts;
+	uint8 low;
+
+	/*
+	 * Read the low byte first, it latches the high byte in TEMP
+	 */
+	low = TIMER1_INITIAL_VALUE_LOW_REGISTER;
+	counts = ((uint16)TIMER1_INITIAL_VALUE_HIGH_REGISTER << 8) | low;
+
+	/*
+	 * The period may have ended after the interrupts were disabled, its
+	 * interrupt is still pending so add it here and read TCNT1 again to be
+	 * sure it is a count of the new period
+	 */
+	if((g_Timer1_timestampSource == TIMESTAMP_COMPARE_A) &&
+			BIT_IS_SET(TIMER1_INTERRUPT_FLAG_REGISTER, TIMER1_OUTPUT_COMPARE_A_MATCH_FLAG))
+	{
+		pending = (uint32)TIMER1_OUTPUT_COMPARE_REGISTER_A + 1;
+		low = TIMER1_INITIAL_VALUE_LOW_REGISTER;
+		counts = ((uint16)TIMER1_INITIAL_VALUE_HIGH_REGISTER << 8) | low;
+	}
+	else if((g_Timer1_timestampSource == TIMESTAMP_OVERFLOW) &&
+			BIT_IS_SET(TIMER1_INTERRUPT_FLAG_REGISTER, TIMER1_OVERFLOW_FLAG))
+	{
+		pending = (uint32)TIMER1_MAXIMUM_COUNTS;
+		low = TIMER1_INITIAL_VALUE_LOW_REGISTER;
+		counts = ((uint16)TIMER1_INITIAL_VALUE_HIGH_REGISTER << 8) | low;
+	}
+
+	return pending + counts;
+}
+/***************************************************************************************************
+ * [Function Name]: Timer1_getCounts
+ *
+ * [Description]:  Function to read the number of Timer1 counts since Timer1_Init,
+ *                 the extension counter and TCNT1 are read as one atomic pair
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Timer1 counts since Timer1_Init, modulo 2^32
+ ***************************************************************************************************/
+uint32 Timer1_getCounts(void)
+{
+	uint8 sreg = SREG_REG;
+	uint32 elapsed;
+
+	SREG_REG = CLEAR_BIT(SREG_REG, I_BIT);
+	elapsed = g_Timer1_elapsedCounts + Timer1_getPendingCounts();
+	SREG_REG = sreg;
+
+	return elapsed;
+}
+/***************************************************************************************************
+ * [Function Name]: Timer1_getMicros
+ *
+ * [Description]:  Function to read the micro seconds since Timer1_Init with the resolution
+ *                 of one Timer1 count, wraps after ~71 minutes like any 32-bit timestamp
+ *                 (or when the 32-bit count of Timer1 wraps if one count is not a whole
+ *                 number of micro seconds) so compare two readings by their difference
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Micro seconds since Timer1_Init
+ ***************************************************************************************************/
+uint32 Timer1_getMicros(void)
+{
+	return Timer1_scaleCounts(Timer1_getCounts(), g_Timer1_usNumerator, g_Timer1_usDenominator);
+}
+/***************************************************************************************************
+ * [Function Name]: Timer1_getMillis
+ *
+ * [Description]:  Function to read the milli seconds since Timer1_Init, the milli seconds are
+ *                 kept apart from the 32-bit count of Timer1 (which wraps after ~3.18 days at
+ *                 1MHz with F_CPU/64) so the value only wraps after 2^32 ms (~49.7 days),
+ *                 compare two readings by their difference
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Milli seconds since Timer1_Init, modulo 2^32
+ ***************************************************************************************************/
+uint32 Timer1_getMillis(void)
+{
+	uint8 sreg = SREG_REG;
+	uint32 millis;
+	uint32 counts;
+
+	SREG_REG = CLEAR_BIT(SREG_REG, I_BIT);
+	millis = g_Timer1_elapsedMillis;
+	counts = g_Timer1_millisCounts + Timer1_getPendingCounts();
+	SREG_REG = sreg;
+
+	/*
+	 * Less than a chunk and two periods of counts left, no overflow
+	 */
+	return millis + Timer1_scaleCounts(counts, g_Timer1_msNumerator, g_Timer1_msDenominator);
+}
+/****************************************************************************************************/
@@ -14,6 +14,7 @@
 
 #include "std_types.h"
 #include"timer_private.h"
+#include"isr_dispatch.h"
 
 #include<avr/io.h>
 
@@ -71,6 +72,7 @@
 #define TIMER1_INPUT_CAPTURE_REGISTER                           ICR1_REG
 #define TIMER1_INTERRUPT_MASK_REGISTER                          TIMSK_REG
 #define TIMER1_INTERRUPT_FLAG_REGISTER                          TIFR_REG
+#define TIMER1_PRESCALER_RESET_REGISTER                         SFIOR_REG
 
 /*TIMER1_CONTROL_A_REGIRSTER*/
 #define TIMER1_WAVE_FORM_GENERATION_BIT10                       WGM10_BIT
@@ -96,6 +98,9 @@
 #define TIMER1_OUTPUT_COMPARE_MATCH_INTERRUPT_B                 OCIE1B_BIT
 #define TIMER1_INPUT_CAPTURE_INTERRUPT_ENABLE                   TICIE1_BIT
 
+/*TIMER1_PRESCALER_RESET_REGISTER (shared with Timer0)*/
+#define TIMER1_PRESCALER_RESET_BIT                              PSR10_BIT
+
 /*TIMER1_INTERRUPT_FLAG_REGISTER*/
 #define  TIMER1_OVERFLOW_FLAG                                   TOV1_BIT
 #define  TIMER1_OUTPUT_COMPARE_A_MATCH_FLAG                     OCF1A_BIT
@@ -125,6 +130,17 @@
 #define TIMER2_OUTPUT_COMPARE_REGISTER                          OCR2_REG
 #define TIMER2_INTERRUPT_MASK_REGISTER                          TIMSK_REG
 #define TIMER2_INTERRUPT_FLAG_REGISTER                          TIFR_REG
+#define TIMER2_ASYNC_STATUS_REGISTER                            ASSR_REG
+#define TIMER2_PRESCALER_RESET_REGISTER                         SFIOR_REG
+
+/*TIMER2_PRESCALER_RESET_REGISTER*/
+#define TIMER2_PRESCALER_RESET_BIT                              PSR2_BIT
+
+/*TIMER2_ASYNC_STATUS_REGISTER*/
+#define TIMER2_CONTROL_UPDATE_BUSY_BIT                          TCR2UB_BIT
+#define TIMER2_COMPARE_UPDATE_BUSY_BIT                          OCR2UB_BIT
+#define TIMER2_COUNTER_UPDATE_BUSY_BIT                          TCN2UB_BIT
+#define TIMER2_ASYNC_CLOCK_BIT                                  AS2_BIT
 
 /*TIMER2_CONTROL_REGIRSTER*/
 #define TIMER2_FORCE_OUTPUT_COMPARE_BIT                         FOC2_BIT
@@ -152,6 +168,14 @@
 #define OC2_PIN                                                   PD7
 #define OC2_DATA_PORT                                             PORTD
 #define OC2_DIRECTION_PORT                                        DDRD
+
+/*
+ * Timer2 RTC mode: 32.768KHz watch crystal on TOSC1/TOSC2,
+ * 32768 / 128 / 256 = 1 overflow every second
+ * (Timer2 clock select codes are 1,8,32,64,128,256,1024 for the values 1..7)
+ */
+#define TIMER2_RTC_CLOCK_128                                       5
+#define TIMER2_ASYNC_UPDATE_BUSY_MASK                              0X07
 /****************************************************************************/
 
 /**************************************************************************
@@ -163,6 +187,33 @@ typedef enum
 
 }Timer_Clock;
 
+/*
+ * Timer2 has its own clock select values (two more pre-scalers)
+ */
+typedef enum
+{
+	T2_NO_CLOCK, T2_F_CPU_CLOCK, T2_F_CPU_8, T2_F_CPU_32, T2_F_CPU_64,
+	T2_F_CPU_128, T2_F_CPU_256, T2_F_CPU_1024
+
+}Timer2_Clock;
+
+typedef enum
+{
+	Timer0_ID, Timer1_ID, Timer2_ID
+
+}Timer_ID;
+
+/*
+ * Interrupt vectors of the timers, each one has its own subscribers list
+ */
+typedef enum
+{
+	Timer0_OVF_Vector, Timer0_COMP_Vector,
+	Timer1_OVF_Vector, Timer1_COMPA_Vector, Timer1_COMPB_Vector, Timer1_CAPT_Vector,
+	Timer2_OVF_Vector, Timer2_COMP_Vector,
+	TIMER_VECTORS
+}Timer_VectorID;
+
 /**************************************************************************
  *                            Timer0 & Timer2
  * ************************************************************************/
@@ -265,7 +316,7 @@ typedef struct
 {
 	uint8 timer2_InitialValue;
 	uint8 timer2_compare_MatchValue;
-	Timer_Clock timer2_clock;
+	Timer2_Clock timer2_clock;
 	Timer_8BIT_Mode  timer2_mode;
 	CompareOutputMode_NonPWM_8BITS Compare_Mode_NonPWM;
 	CompareOutputMode_FASTPWM_8BITS Compare_Mode_FASTPWM;
@@ -273,6 +324,100 @@ typedef struct
 
 }Timer2_ConfigType;
 
+/*
+ * Result of the period solver, clock is a Timer_Clock for Timer0/Timer1
+ * and a Timer2_Clock for Timer2
+ */
+typedef struct
+{
+	uint8 clock;
+	uint16 prescaler;
+	uint16 compareValue;
+	uint32 errorPPM;
+
+}Timer_PeriodType;
+
+/**************************************************************************
+ *                             Period Solver                              *
+ * ************************************************************************/
+/*
+ * Timer_solvePeriod/Timer_solveFrequency choose the pre-scaler at run time,
+ * they need 64-bit multiply and divide (__muldi3/__udivdi3) so they are only
+ * built with TIMER_RUNTIME_SOLVER TRUE, the macros below do the same work at
+ * compile time for the periods known when building
+ */
+#ifndef TIMER_RUNTIME_SOLVER
+#define TIMER_RUNTIME_SOLVER                  FALSE
+#endif
+
+/*
+ * Compile time choice of the pre-scaler and the compare value for a wanted
+ * period of NUM/DEN seconds: the smallest pre-scaler whose rounded count
+ * fits the timer gives the finest resolution, the compare value is count-1
+ * (CTC). All the macros are usable in #if so the build can check the error:
+ *
+ *   #if (TIMER_ERROR_PPM_US(TIMER0, 1000) > 100)
+ *   #error "1ms tick is not accurate enough"
+ *   #endif
+ */
+#define TIMER_PERIOD_COUNTS(NUM, DEN, P) \
+	(((F_CPU) * 1ULL * (NUM) + (P) * 1ULL * (DEN) / 2) / ((P) * 1ULL * (DEN)))
+
+#define TIMER_PERIOD_FITS(NUM, DEN, P, MAX) \
+	((TIMER_PERIOD_COUNTS(NUM, DEN, P) >= 1) && (TIMER_PERIOD_COUNTS(NUM, DEN, P) <= (MAX)))
+
+#define TIMER_PERIOD_ERROR_PPM(NUM, DEN, P) \
+	(((TIMER_PERIOD_COUNTS(NUM, DEN, P) * (P) * (DEN) > (F_CPU) * 1ULL * (NUM)) ? \
+	  (TIMER_PERIOD_COUNTS(NUM, DEN, P) * (P) * (DEN) - (F_CPU) * 1ULL * (NUM)) : \
+	  ((F_CPU) * 1ULL * (NUM) - TIMER_PERIOD_COUNTS(NUM, DEN, P) * (P) * (DEN))) * \
+	 1000000ULL / ((F_CPU) * 1ULL * (NUM)))
+
+/*Pre-scalers of Timer0 & Timer1: 1, 8, 64, 256, 1024*/
+#define TIMER_PRESCALER_SELECT(NUM, DEN, MAX) \
+	(TIMER_PERIOD_FITS(NUM, DEN, 1, MAX)   ? 1   : \
+	 TIMER_PERIOD_FITS(NUM, DEN, 8, MAX)   ? 8   : \
+	 TIMER_PERIOD_FITS(NUM, DEN, 64, MAX)  ? 64  : \
+	 TIMER_PERIOD_FITS(NUM, DEN, 256, MAX) ? 256 : 1024)
+
+#define TIMER0_PRESCALER_SELECT(NUM, DEN)   TIMER_PRESCALER_SELECT(NUM, DEN, 256ULL)
+#define TIMER1_PRESCALER_SELECT(NUM, DEN)   TIMER_PRESCALER_SELECT(NUM, DEN, 65536ULL)
+
+/*Pre-scalers of Timer2: 1, 8, 32, 64, 128, 256, 1024*/
+#define TIMER2_PRESCALER_SELECT(NUM, DEN) \
+	(TIMER_PERIOD_FITS(NUM, DEN, 1, 256ULL)   ? 1   : \
+	 TIMER_PERIOD_FITS(NUM, DEN, 8, 256ULL)   ? 8   : \
+	 TIMER_PERIOD_FITS(NUM, DEN, 32, 256ULL)  ? 32  : \
+	 TIMER_PERIOD_FITS(NUM, DEN, 64, 256ULL)  ? 64  : \
+	 TIMER_PERIOD_FITS(NUM, DEN, 128, 256ULL) ? 128 : \
+	 TIMER_PERIOD_FITS(NUM, DEN, 256, 256ULL) ? 256 : 1024)
+
+#define TIMER0_MAXIMUM_COUNTS               256ULL
+#define TIMER1_MAXIMUM_COUNTS               65536ULL
+#define TIMER2_MAXIMUM_COUNTS               256ULL
+
+#define TIMER0_CLOCK_OF(P) \
+	((P) == 1 ? F_CPU_CLOCK : (P) == 8 ? F_CPU_8 : (P) == 64 ? F_CPU_64 : (P) == 256 ? F_CPU_256 : F_CPU_1024)
+#define TIMER1_CLOCK_OF(P)                  TIMER0_CLOCK_OF(P)
+#define TIMER2_CLOCK_OF(P) \
+	((P) == 1 ? T2_F_CPU_CLOCK : (P) == 8 ? T2_F_CPU_8 : (P) == 32 ? T2_F_CPU_32 : (P) == 64 ? T2_F_CPU_64 : \
+	 (P) == 128 ? T2_F_CPU_128 : (P) == 256 ? T2_F_CPU_256 : T2_F_CPU_1024)
+
+/*TIMER --> TIMER0, TIMER1 or TIMER2, wanted period in micro seconds*/
+#define TIMER_PRESCALER_US(TIMER, US)        TIMER##_PRESCALER_SELECT(US, 1000000UL)
+#define TIMER_CLOCK_US(TIMER, US)            TIMER##_CLOCK_OF(TIMER_PRESCALER_US(TIMER, US))
+#define TIMER_COMPARE_US(TIMER, US)          (TIMER_PERIOD_COUNTS(US, 1000000UL, TIMER_PRESCALER_US(TIMER, US)) - 1)
+#define TIMER_ERROR_PPM_US(TIMER, US)        TIMER_PERIOD_ERROR_PPM(US, 1000000UL, TIMER_PRESCALER_US(TIMER, US))
+#define TIMER_IN_RANGE_US(TIMER, US) \
+	TIMER_PERIOD_FITS(US, 1000000UL, TIMER_PRESCALER_US(TIMER, US), TIMER##_MAXIMUM_COUNTS)
+
+/*TIMER --> TIMER0, TIMER1 or TIMER2, wanted frequency in Hz*/
+#define TIMER_PRESCALER_HZ(TIMER, HZ)        TIMER##_PRESCALER_SELECT(1, HZ)
+#define TIMER_CLOCK_HZ(TIMER, HZ)            TIMER##_CLOCK_OF(TIMER_PRESCALER_HZ(TIMER, HZ))
+#define TIMER_COMPARE_HZ(TIMER, HZ)          (TIMER_PERIOD_COUNTS(1, HZ, TIMER_PRESCALER_HZ(TIMER, HZ)) - 1)
+#define TIMER_ERROR_PPM_HZ(TIMER, HZ)        TIMER_PERIOD_ERROR_PPM(1, HZ, TIMER_PRESCALER_HZ(TIMER, HZ))
+#define TIMER_IN_RANGE_HZ(TIMER, HZ) \
+	TIMER_PERIOD_FITS(1, HZ, TIMER_PRESCALER_HZ(TIMER, HZ), TIMER##_MAXIMUM_COUNTS)
+
 /**************************************************************************
  *                                Timer0
  * ************************************************************************/
@@ -480,6 +625,44 @@ void Timer1_Start(Timer_Clock timer1_clock_value);
  * [Returns]:       NONE
  ***************************************************************************************************/
 void Timer1_Change_CompareMatchValue(uint16 timer1_newCompareValue, Channel_Type channel);
+/***************************************************************************************************
+ * [Function Name]: Timer1_setFractionalCompare
+ *
+ * [Description]:  Function to make Timer1 CTC_OCR1A mode generate a period which is not
+ *                 a whole number of timer counts without long run drift
+ *                 - The period is (base + remainder/denominator) timer counts
+ *                 - Every period is base or base+1 counts, OCR1A is updated in the
+ *                   compare match interrupt and the error never exceeds one count
+ *
+ * [Args]:         base, remainder, denominator
+ *
+ * [In]            base: Whole timer counts of the period
+ *                 remainder: Numerator of the fraction of a count, less than denominator
+ *                 denominator: Denominator of the fraction of a count, 0 to disable
+ *                              (for a period of T seconds use F_CPU*T/prescaler as
+ *                              base + remainder/prescaler)
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer1_setFractionalCompare(uint16 base, uint16 remainder, uint16 denominator);
+/***************************************************************************************************
+ * [Function Name]: Timer1_restartPeriod
+ *
+ * [Description]:  Function to start a new compare period of Timer1 now, so the next compare
+ *                 match A comes one full period later, a pending match is dropped and the
+ *                 fractional compare starts again, the timestamp keeps counting
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer1_restartPeriod(void);
 /**************************************************************************
  *                                Timer2
  * ************************************************************************/
@@ -559,14 +742,14 @@ void Timer2_Stop(void);
  * [Args]:        timer2_clock_value
  *
  *
- * [In]           timer2_clock_value:  -Variable from type enum Timer_Clock
+ * [In]           timer2_clock_value:  -Variable from type enum Timer2_Clock
  *                                     -To use it to choose the clock of the timer
  *
  * [Out]           NONE
  *
  * [Returns]:      NONE
  ***************************************************************************************************/
-void Timer2_Start(Timer_Clock timer2_clock_value);
+void Timer2_Start(Timer2_Clock timer2_clock_value);
 /***************************************************************************************************
  * [Function Name]: Timer2_Change_CompareMatchValue
  *
@@ -581,5 +764,194 @@ void Timer2_Start(Timer_Clock timer2_clock_value);
  * [Returns]:       NONE
  ***************************************************************************************************/
 void Timer2_Change_CompareMatchValue(uint8 timer2_newCompareValue);
+/***************************************************************************************************
+ * [Function Name]: Timer2_RTC_Init
+ *
+ * [Description]:  Function to Initialize Timer2 as a real time clock
+ *                 - Clocked asynchronously from a 32.768KHz watch crystal on TOSC1/TOSC2
+ *                 - Overflow interrupt every 1 second, the Timer2 call back is called
+ *                 - Keeps counting in the power-save sleep mode
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer2_RTC_Init(void);
+/***************************************************************************************************
+ * [Function Name]: Timer2_RTC_Start
+ *
+ * [Description]:  Function to restart the clock of Timer2 in RTC mode after Timer2_Stop
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer2_RTC_Start(void);
+/***************************************************************************************************
+ * [Function Name]: Timer2_RTC_restartPeriod
+ *
+ * [Description]:  Function to start a new overflow period of Timer2 in RTC mode now, so the
+ *                 next overflow comes one full period later and a pending overflow is dropped
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer2_RTC_restartPeriod(void);
+/***************************************************************************************************
+ * [Function Name]: Timer2_RTC_prepareSleep
+ *
+ * [Description]:  Function to call before entering power-save sleep in RTC mode, it makes
+ *                 sure one crystal cycle passed since the last wake up so the overflow
+ *                 interrupt logic is ready to wake the CPU again
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer2_RTC_prepareSleep(void);
+/**************************************************************************
+ *                           Vector Subscribers                           *
+ * ************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: Timer_subscribe
+ *
+ * [Description]:  Function to add a handler called from one timer interrupt vector, every
+ *                 vector has its own list of ISR_DISPATCH_MAX_SUBSCRIBERS handlers
+ *
+ * [Args]:         a_vector, a_handler, a_context
+ *
+ * [In]            a_vector:  Interrupt vector of the timer
+ *                 a_handler: Function called from the ISR with a_context
+ *                 a_context: Pointer passed back to the handler, may be NULL_PTR
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      FALSE if the vector is not valid or its list is full
+ ***************************************************************************************************/
+bool Timer_subscribe(Timer_VectorID a_vector, void (*a_handler)(void *a_context), void *a_context);
+/***************************************************************************************************
+ * [Function Name]: Timer_unsubscribe
+ *
+ * [Description]:  Function to remove a handler added by Timer_subscribe
+ *
+ * [Args]:         a_vector, a_handler, a_context
+ *
+ * [In]            a_vector:  Interrupt vector of the timer
+ *                 a_handler: Function given to Timer_subscribe
+ *                 a_context: Context given to Timer_subscribe
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      NONE
+ ***************************************************************************************************/
+void Timer_unsubscribe(Timer_VectorID a_vector, void (*a_handler)(void *a_context), void *a_context);
+/**************************************************************************
+ *                              Timestamp                                 *
+ * ************************************************************************/
+/***************************************************************************************************
+ * [Function Name]: Timer1_getCounts
+ *
+ * [Description]:  Function to read the number of Timer1 counts since Timer1_Init,
+ *                 the extension counter and TCNT1 are read as one atomic pair
+ *                 (Timer1 in Normal or CTC_OCR1A mode)
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Timer1 counts since Timer1_Init, modulo 2^32
+ ***************************************************************************************************/
+uint32 Timer1_getCounts(void);
+/***************************************************************************************************
+ * [Function Name]: Timer1_getMicros
+ *
+ * [Description]:  Function to read the micro seconds since Timer1_Init with the resolution
+ *                 of one Timer1 count, wraps after ~71 minutes like any 32-bit timestamp
+ *                 (or when the 32-bit count of Timer1 wraps if one count is not a whole
+ *                 number of micro seconds) so compare two readings by their difference
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Micro seconds since Timer1_Init
+ ***************************************************************************************************/
+uint32 Timer1_getMicros(void);
+/***************************************************************************************************
+ * [Function Name]: Timer1_getMillis
+ *
+ * [Description]:  Function to read the milli seconds since Timer1_Init, the milli seconds are
+ *                 kept apart from the 32-bit count of Timer1 (which wraps after ~3.18 days at
+ *                 1MHz with F_CPU/64) so the value only wraps after 2^32 ms (~49.7 days),
+ *                 compare two readings by their difference
+ *
+ * [Args]:         NONE
+ *
+ * [In]            NONE
+ *
+ * [Out]           NONE
+ *
+ * [Returns]:      Milli seconds since Timer1_Init, modulo 2^32
+ ***************************************************************************************************/
+uint32 Timer1_getMillis(void);
+/**************************************************************************
+ *                             Period Solver                              *
+ * ************************************************************************/
+#if (TIMER_RUNTIME_SOLVER == TRUE)
+/***************************************************************************************************
+ * [Function Name]: Timer_solvePeriod
+ *
+ * [Description]:  Function to choose the pre-scaler and the CTC compare value of a timer
+ *                 for a wanted period, the smallest pre-scaler whose count fits the timer
+ *                 is chosen as it gives the finest resolution
+ *
+ * [Args]:         timer, period_us, result_PTR
+ *
+ * [In]            timer:     Timer0_ID, Timer1_ID or Timer2_ID
+ *                 period_us: Wanted period in micro seconds
+ *
+ * [Out]           result_PTR: Clock, pre-scaler, compare value and the error in ppm
+ *
+ * [Returns]:      FALSE if the period is too short or too long for the timer
+ ***************************************************************************************************/
+bool Timer_solvePeriod(Timer_ID timer, uint32 period_us, Timer_PeriodType *result_PTR);
+/***************************************************************************************************
+ * [Function Name]: Timer_solveFrequency
+ *
+ * [Description]:  Function to choose the pre-scaler and the CTC compare value of a timer
+ *                 for a wanted interrupt frequency, same as Timer_solvePeriod
+ *
+ * [Args]:         timer, frequency_hz, result_PTR
+ *
+ * [In]            timer:        Timer0_ID, Timer1_ID or Timer2_ID
+ *                 frequency_hz: Wanted frequency in Hz
+ *
+ * [Out]           result_PTR: Clock, pre-scaler, compare value and the error in ppm
+ *
+ * [Returns]:      FALSE if the frequency is too high or too low for the timer
+ ***************************************************************************************************/
+bool Timer_solveFrequency(Timer_ID timer, uint32 frequency_hz, Timer_PeriodType *result_PTR);
+#endif
 /****************************************************************************************************/
 #endif /* TIMER_INTERFACE_H_ */
@@ -38,12 +38,13 @@
 #define OCF0_BIT                               1
 
 #define PSR10_BIT                              0
+#define PSR2_BIT                               1
 
 /**************************************************************************
  *                      Timer1 Registers & Bits                           *
  **************************************************************************/
-#define TCCR1A_REG                           (*( (volatile uint16 *)(0X4F) ))
-#define TCCR1B_REG                           (*( (volatile uint16 *)(0X4E) ))
+#define TCCR1A_REG                           (*( (volatile uint8  *)(0X4F) ))
+#define TCCR1B_REG                           (*( (volatile uint8  *)(0X4E) ))
 #define TCNT1L_REG                           (*( (volatile uint8  *)(0X4C) ))
 #define TCNT1H_REG                           (*( (volatile uint8  *)(0X4D) ))
 #define TCNT1_REG                            (*( (volatile uint16 *)(0X4C) ))
@@ -102,17 +103,60 @@
 #define WGM20_BIT                              6
 #define FOC2_BIT                               7
 
+#define TCR2UB_BIT                             0
+#define OCR2UB_BIT                             1
+#define TCN2UB_BIT                             2
+#define AS2_BIT                                3
+
 #define TOIE2_BIT                              6
 #define OCIE2_BIT                              7
 
 #define TOV2_BIT                               6
 #define OCF2_BIT                               7
 
+/**************************************************************************
+ *                        Timers Mode Descriptors                         *
+ * ************************************************************************/
+/*
+ * Timer_8BIT_Mode and Timer_16BIT_Mode are numbered as the WGM bits of
+ * the mode, so the waveform bits come from the mode itself and one flash
+ * byte per mode describes the rest of the configuration
+ */
+#define MODE_OUTPUT_MASK                       0X03
+#define MODE_OUTPUT_NON_PWM                    0X00
+#define MODE_OUTPUT_PHASE_CORRECT              0X01
+#define MODE_OUTPUT_FAST_PWM                   0X02
+#define MODE_OVERFLOW_INTERRUPT                0X04
+#define MODE_COMPARE_INTERRUPT                 0X08
+#define MODE_COMPARE_VALUE                     0X10
+#define MODE_INPUT_CAPTURE_TOP                 0X20
+#define MODE_RESERVED                          0X80
+
+/*Timer0 & Timer2 mode number --> WGMx0 bit 6, WGMx1 bit 3 of TCCRx*/
+#define WGM_8BIT_BIT0_MASK                     0X01
+#define WGM_8BIT_BIT1_MASK                     0X02
+
+/*Timer1 mode number --> WGM11:10 in TCCR1A, WGM13:12 in TCCR1B*/
+#define WGM_16BIT_LOW_MASK                     0X03
+#define WGM_16BIT_HIGH_SHIFT                   2
+#define TCCR1B_WGM_CLOCK_MASK_CLEAR            0XE0
+
+/*Timer1 interrupt which extends the timestamp*/
+#define TIMESTAMP_NONE                         0
+#define TIMESTAMP_OVERFLOW                     1
+#define TIMESTAMP_COMPARE_A                    2
+
 /**************************************************************************
  *                         Interrupts Registers                           *
  * ************************************************************************/
 #define TIMSK_REG                            (*( (volatile uint8 *)(0X59) ))
 #define TIFR_REG                             (*( (volatile uint8 *)(0X58) ))
+/**************************************************************************
+ *                           Status Register                              *
+ * ************************************************************************/
+#define SREG_REG                             (*( (volatile uint8 *)(0X5F) ))
+
+#define I_BIT                                  7
 /**************************************************************************
  *          Handing Interrupt service routine & Vector Table              *
  * ************************************************************************/